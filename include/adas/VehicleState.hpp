@@ -1,7 +1,23 @@
 #pragma once
 
+#include <cstdint>
+#include "adas/events/EventType.hpp"
+
 namespace adas {
 
+// Provenance of an actuator command: the oldest sensor input it was computed from.
+struct InputStamp {
+    uint64_t          acquired_us = 0;  // Acquisition time of that input; 0 = command not set
+    events::EventType source      = events::EventType::RADAR_UPDATE;
+};
+
+// The older of two stamps, ignoring unset (zero) ones.
+inline InputStamp olderInput(const InputStamp& a, const InputStamp& b) {
+    if (a.acquired_us == 0) return b;
+    if (b.acquired_us == 0) return a;
+    return (b.acquired_us < a.acquired_us) ? b : a;
+}
+
 // Shared state written by ADAS features each processing cycle.
 // Acts as the output interface between features and the actuator layer.
 struct VehicleState {
@@ -22,6 +38,11 @@ struct VehicleState {
     float brake_intensity  = 0.0f;     // Brake force [0.0 – 1.0]
     bool  dow_warning      = false;    // Door Open Warning active
     bool  door_open        = false;    // Physical door state
+
+    // Inputs behind each actuator command, for sensor-to-actuator latency
+    InputStamp brake_input;            // brake_intensity
+    InputStamp acceleration_input;     // ego_acceleration
+    InputStamp steering_input;         // steering_angle_rad
 };
 
 } // namespace adas
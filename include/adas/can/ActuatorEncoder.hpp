@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include "adas/can/CanDecoder.hpp"
+#include "adas/VehicleState.hpp"
+
+namespace adas {
+namespace can {
+
+// When a changed actuator request is worth a frame.
+struct ActuatorOutputConfig {
+    float    brake_deadband          = 0.01f;    // brake_intensity [0 – 1]
+    float    acceleration_deadband   = 0.05f;    // m/s²
+    float    steering_deadband       = 0.002f;   // rad
+    uint64_t brake_refresh_us        = 100'000;  // Resend unchanged requests this often
+    uint64_t acceleration_refresh_us = 100'000;
+    uint64_t steering_refresh_us     = 100'000;
+    uint64_t dow_refresh_us          = 500'000;
+};
+
+// Output stage after AdasManager::execute(): turns each cycle's VehicleState
+// into actuator frames, sending a message only when its request moved past
+// the deadband, a flag flipped, a value returned to zero, or its refresh
+// timer ran out:
+//
+//   0x200 BRAKE  brake_requested, brake_intensity
+//   0x201 ACCEL  ego_acceleration
+//   0x202 STEER  steering_angle_rad
+//   0x203 DOW    dow_warning
+//
+// Comparisons are against the last value sent, so slow drift inside the
+// deadband still goes out once it adds up.
+class ActuatorEncoder {
+public:
+    using Sink = std::function<void(const CanFrame&)>;
+
+    explicit ActuatorEncoder(Sink sink, const ActuatorOutputConfig& config = ActuatorOutputConfig{});
+
+    // Encode the cycle's requests at time_us. Returns the number of frames sent.
+    std::size_t update(const VehicleState& state, uint64_t time_us);
+
+    // Send every message on the next update(), e.g. after an actuator reset.
+    void invalidate();
+
+    uint64_t framesSent() const { return sent_; }
+    uint64_t framesSuppressed() const { return suppressed_; }
+
+private:
+    static constexpr std::size_t kMessages = 4;
+
+    struct Channel {
+        float    value   = 0.0f;  // Last value sent
+        bool     flag    = false;
+        bool     sent    = false;  // Anything sent yet
+        uint64_t sent_us = 0;
+    };
+
+    bool due(Channel& ch, float value, bool flag, float deadband, uint64_t refresh_us, uint64_t time_us);
+    void send(std::size_t message, float value, bool flag, uint64_t time_us);
+
+    Sink                           sink_;
+    ActuatorOutputConfig           cfg_;
+    std::array<Channel, kMessages> channels_{};
+    uint64_t                       sent_       = 0;
+    uint64_t                       suppressed_ = 0;
+};
+
+} // namespace can
+} // namespace adas
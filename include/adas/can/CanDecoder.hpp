@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include "adas/events/EventData.hpp"
+#include "adas/events/EventType.hpp"
+#include "adas/features/AdasManager.hpp"
+
+namespace adas {
+namespace can {
+
+// A classic CAN or CAN-FD frame. data is padded past the largest payload so
+// signal extraction can always load 8 bytes without a bounds check.
+struct CanFrame {
+    static constexpr std::size_t kMaxData = 64;
+
+    uint64_t time_us = 0;  // Receive time, e.g. from the candump timestamp
+    uint32_t id       = 0;  // 11-bit identifier, or 29-bit if extended
+    uint8_t  length   = 0;  // Payload bytes
+    bool     fd       = false;
+    bool     extended = false;
+    std::array<uint8_t, kMaxData + 8> data{};
+};
+
+enum class ByteOrder : uint8_t {
+    INTEL,    // Little endian; start_bit is the LSB
+    MOTOROLA  // Big endian; start_bit is the MSB (DBC sawtooth numbering)
+};
+
+// A signal as written in a DBC file: physical = raw * scale + offset.
+struct CanSignal {
+    uint16_t  start_bit = 0;
+    uint8_t   length    = 1;  // Bits, 1 .. 32
+    ByteOrder order     = ByteOrder::INTEL;
+    bool      is_signed = false;
+    float     scale     = 1.0f;
+    float     offset    = 0.0f;
+};
+
+// A CanSignal reduced to the constants used by the branch-free extractor.
+struct CompiledSignal {
+    uint8_t  byte;        // First byte of the 8-byte window
+    uint8_t  shift;       // LSB position within the window
+    uint8_t  big_endian;  // 1: read the window big endian
+    uint64_t mask;        // length ones
+    uint64_t sign;        // Sign bit for signed signals, else 0
+    float    scale;
+    float    offset;
+};
+
+CompiledSignal compile(const CanSignal& signal);
+
+// Physical value of a compiled signal in frame data (kMaxData + 8 bytes).
+float extract(const CompiledSignal& signal, const uint8_t* data);
+
+// Write value into frame data (kMaxData + 8 bytes), rounding to the signal's
+// resolution and saturating to its raw range. Other bits are preserved.
+void insert(const CompiledSignal& signal, float value, uint8_t* data);
+
+// Decodes the ADAS sensor frames into EventBus payloads:
+//
+//   0x120 RADAR  distance_m, target_speed_mps, confidence  → RADAR_UPDATE
+//   0x130 SPEED  speed_mps (Motorola)                       → SPEED_UPDATE
+//   0x140 LANE   lateral_deviation_m, confidence            → LANE_UPDATE
+//   0x150 DOOR   is_open                                    → DOOR_UPDATE
+//
+// Frame lookup is a direct index on the 11-bit identifier; payloads are
+// stamped with the frame's receive time as acquired_us. Extended (29-bit)
+// frames never match, whatever their identifier.
+class CanDecoder {
+public:
+    CanDecoder();
+
+    // Returns false for unknown identifiers, extended frames and frames
+    // shorter than the message definition.
+    bool decode(const CanFrame& frame, events::EventType& type, events::EventData& data) const;
+
+    // Decode and publish to the manager. Returns true if an event was published.
+    bool feed(const CanFrame& frame, features::AdasManager& mgr) const;
+
+private:
+    static constexpr uint8_t kNoMessage = 0xFF;
+    std::array<uint8_t, 2048> index_;  // id → message table slot
+};
+
+// Parse one candump line, either the log format written by `candump -l`
+//   (1697040000.123456) can0 120#0011223344556677
+// or the CAN-FD form with "##<flags>" before the data. An 8-digit id, as
+// candump prints them, is an extended (29-bit) id; shorter ones are 11-bit.
+// Returns false if the line is not a frame.
+bool parseCandumpLine(const std::string& line, CanFrame& frame);
+
+// Reads frames from a candump log, skipping lines that do not parse.
+class CandumpReader {
+public:
+    explicit CandumpReader(std::istream& in) : in_(in) {}
+
+    bool next(CanFrame& frame);
+
+    std::size_t skippedLines() const { return skipped_; }
+
+private:
+    std::istream& in_;
+    std::string   line_;
+    std::size_t   skipped_ = 0;
+};
+
+} // namespace can
+} // namespace adas
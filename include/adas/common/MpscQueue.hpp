@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace adas {
+namespace common {
+
+// Bounded lock-free queue for any number of producer threads and one
+// consumer thread. Neither side ever blocks or allocates after construction:
+// push() fails when the queue is full and pop() when it is empty.
+//
+// Each slot carries a sequence number telling whose turn it is. A producer
+// claims the tail slot with a CAS and a producer that loses the race moves
+// on to the next slot, so no producer ever waits for another to finish.
+// Items are popped in the order their slots were claimed; the consumer
+// waits (pop() fails) while the oldest claimed slot is still being written.
+template <typename T>
+class MpscQueue {
+public:
+    // Capacity is rounded up to a power of two.
+    explicit MpscQueue(std::size_t capacity)
+        : mask_(roundUp(capacity) - 1), slots_(new Slot[mask_ + 1]) {
+        for (std::size_t i = 0; i <= mask_; ++i) slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    // Any thread.
+    bool push(T value) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot&             slot = slots_[tail & mask_];
+            const auto        lag  = static_cast<std::ptrdiff_t>(
+                slot.seq.load(std::memory_order_acquire) - tail);
+            if (lag == 0) {
+                if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                    slot.value = std::move(value);
+                    slot.seq.store(tail + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (lag < 0) {
+                return false;  // The consumer has not freed this slot yet: full
+            } else {
+                tail = tail_.load(std::memory_order_relaxed);  // Another producer took it
+            }
+        }
+    }
+
+    // Consumer only. The slot is reset so it does not keep resources alive.
+    bool pop(T& out) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        Slot&             slot = slots_[head & mask_];
+        if (slot.seq.load(std::memory_order_acquire) != head + 1) return false;
+        out        = std::move(slot.value);
+        slot.value = T{};
+        slot.seq.store(head + mask_ + 1, std::memory_order_release);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    // Successful pushes so far, counting those still being written: pop()
+    // returns each of them once.
+    std::size_t pushed() const { return tail_.load(std::memory_order_acquire); }
+
+    // Approximate when called concurrently with push() or pop().
+    std::size_t size() const { return pushed() - head_.load(std::memory_order_acquire); }
+
+private:
+    static constexpr std::size_t kCacheLine = 64;
+
+    struct Slot {
+        std::atomic<std::size_t> seq{0};  // == index: free; index + 1: holds an item
+        T                        value{};
+    };
+
+    static std::size_t roundUp(std::size_t n) {
+        std::size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    const std::size_t       mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};  // Next slot to pop
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};  // Next slot to claim
+};
+
+} // namespace common
+} // namespace adas
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace adas {
+namespace common {
+
+// Single-writer, many-reader snapshot of a trivially copyable value.
+//
+// write() never waits: it bumps the sequence to odd, stores the value and
+// bumps it to even again. Readers copy the value and retry if the sequence
+// was odd or changed meanwhile. The value is held as relaxed atomic words,
+// so a torn read is detected rather than undefined.
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock needs a trivially copyable value");
+
+public:
+    Seqlock() { store(T{}); }
+
+    Seqlock(const Seqlock&) = delete;
+    Seqlock& operator=(const Seqlock&) = delete;
+
+    // Writer thread only.
+    void write(const T& value) {
+        const uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        store(value);
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    // One attempt; false if a write overlapped it. On success, version is
+    // the number of write() calls the value reflects (0: default value).
+    bool tryRead(T& out, uint64_t* version = nullptr) const {
+        const uint64_t before = seq_.load(std::memory_order_acquire);
+        if (before & 1) return false;
+        uint64_t buffer[kWords];
+        for (std::size_t i = 0; i < kWords; ++i) buffer[i] = words_[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq_.load(std::memory_order_relaxed) != before) return false;
+        std::memcpy(&out, buffer, sizeof(T));
+        if (version) *version = before / 2;
+        return true;
+    }
+
+    // Retry until a consistent copy is read, yielding so that a preempted
+    // writer on the same core can finish.
+    T read(uint64_t* version = nullptr) const {
+        T out;
+        while (!tryRead(out, version)) std::this_thread::yield();
+        return out;
+    }
+
+private:
+    void store(const T& value) {
+        uint64_t buffer[kWords] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+        for (std::size_t i = 0; i < kWords; ++i) words_[i].store(buffer[i], std::memory_order_relaxed);
+    }
+
+    static constexpr std::size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    alignas(64) std::atomic<uint64_t> seq_{0};
+    std::array<std::atomic<uint64_t>, kWords> words_{};
+};
+
+} // namespace common
+} // namespace adas
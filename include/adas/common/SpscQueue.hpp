@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace adas {
+namespace common {
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. Neither side ever blocks or allocates after construction: push()
+// fails when the queue is full and pop() when it is empty.
+//
+// head_ and tail_ sit on separate cache lines, and each side keeps a cached
+// copy of the other's index so that it only touches the shared line when
+// its cached view says the queue is full (or empty).
+template <typename T>
+class SpscQueue {
+public:
+    // Capacity is rounded up to a power of two.
+    explicit SpscQueue(std::size_t capacity)
+        : mask_(roundUp(capacity) - 1), slots_(new T[mask_ + 1]) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer only.
+    bool push(T value) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - producer_head_ > mask_) {
+            producer_head_ = head_.load(std::memory_order_acquire);
+            if (tail - producer_head_ > mask_) return false;
+        }
+        slots_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only. The slot is reset so it does not keep resources alive.
+    bool pop(T& out) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == consumer_tail_) {
+            consumer_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == consumer_tail_) return false;
+        }
+        out                  = std::move(slots_[head & mask_]);
+        slots_[head & mask_] = T{};
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    // Approximate when called concurrently with push() or pop().
+    std::size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr std::size_t kCacheLine = 64;
+
+    static std::size_t roundUp(std::size_t n) {
+        std::size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    const std::size_t    mask_;
+    std::unique_ptr<T[]> slots_;
+
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};  // Next slot to pop
+    std::size_t consumer_tail_ = 0;                          // Consumer's view of tail_
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};  // Next slot to push
+    std::size_t producer_head_ = 0;                          // Producer's view of head_
+};
+
+} // namespace common
+} // namespace adas
@@ -5,12 +5,17 @@ namespace diagnostics {
 
 // Diagnostic Trouble Codes reported by ADAS features when faults are detected.
 enum class DTC {
-    AEB_SENSOR_FAULT    = 0x1001,  // AEB could not get valid sensor data
-    AEB_ACTIVATED       = 0x1002,  // AEB triggered an emergency brake
-    ACC_SENSOR_FAULT    = 0x1003,  // ACC could not get valid sensor data
-    LKA_LOW_CONFIDENCE  = 0x1004,  // Camera confidence too low for lane assist
-    DOW_SENSOR_FAULT    = 0x1005,  // DOW could not get valid radar data
-    DOW_WARNING_ACTIVE  = 0x1006   // Vehicle approaching while door is open
+    AEB_SENSOR_FAULT      = 0x1001,  // AEB could not get valid sensor data
+    AEB_ACTIVATED         = 0x1002,  // AEB triggered an emergency brake
+    ACC_SENSOR_FAULT      = 0x1003,  // ACC could not get valid sensor data
+    LKA_LOW_CONFIDENCE    = 0x1004,  // Camera confidence too low for lane assist
+    DOW_SENSOR_FAULT      = 0x1005,  // DOW could not get valid radar data
+    DOW_WARNING_ACTIVE    = 0x1006,  // Vehicle approaching while door is open
+    EVENT_DEADLINE_MISSED = 0x1007,  // A feature handled an event later than its deadline
+    LOAD_SHED_ACTIVE      = 0x1008,  // Cycle overran its budget; low-criticality features degraded
+    LOAD_SHED_RELEASED    = 0x1009,  // Load dropped; one shedding level restored
+    SIGNAL_TIMEOUT        = 0x100A,  // A monitored sensor input stopped arriving
+    SIGNAL_RECOVERED      = 0x100B   // A timed-out sensor input is arriving again
 };
 
 // Indicates how critical a reported DTC is.
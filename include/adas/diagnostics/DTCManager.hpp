@@ -1,32 +1,111 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <memory>
 #include <vector>
 #include "adas/diagnostics/DTCEntry.hpp"
+#include "adas/diagnostics/DTCQuery.hpp"
+#include "adas/diagnostics/DTCSink.hpp"
+#include "adas/snapshot/Snapshot.hpp"
 
 namespace adas {
 namespace diagnostics {
 
 // Collects and stores diagnostic trouble codes reported by ADAS features.
+// Keeps a timestamp-ordered index alongside the log so time-range queries
+// are a binary search rather than a full scan.
+//
+// The log itself belongs to one thread. Other threads post() instead: each
+// gets its own lock-free buffer, drained into the log by mergePosted(). The
+// buffer of a thread that has exited is freed by the next merge. A
+// moved-from manager drops posts.
 class DTCManager {
 public:
+    // Longest message kept by post(); longer ones are truncated.
+    static constexpr std::size_t kPostedMessageLength = 55;
+    // Reports each thread can have outstanding between merges.
+    static constexpr std::size_t kPostCapacity = 64;
+
+    DTCManager();
+    ~DTCManager();
+    DTCManager(DTCManager&&) noexcept;
+    DTCManager& operator=(DTCManager&&) noexcept;
+
     // Record a new DTC event.
     void report(DTC code, Severity severity,
                 const std::string& message, uint64_t timestamp_ms);
 
+    // Queue a report from any thread. Never locks or allocates once the
+    // thread's buffer exists; when the buffer is full the report is dropped
+    // and counted in droppedPosts().
+    void post(DTC code, Severity severity, const char* message, uint64_t timestamp_ms);
+
+    // Move every posted report into the log, ordered by timestamp, then
+    // code, so the log does not depend on thread timing. Returns the number
+    // merged. Call from the thread that owns the log, e.g. at cycle end.
+    std::size_t mergePosted();
+
+    uint64_t droppedPosts() const;
+
+    // Threads holding a post buffer, including exited ones not yet merged.
+    std::size_t postBuffers() const;
+
     // Remove all active entries for the given code.
     void clear(DTC code);
 
+    // Remove every entry. Posted reports not yet merged are kept.
+    void clear();
+
     // Returns true if the given code has at least one active entry.
     bool hasActive(DTC code) const;
 
     // Read-only access to the full log.
     const std::vector<DTCEntry>& entries() const;
 
+    // Entries matching the query, in timestamp order.
+    // Pointers stay valid until the next report() or clear().
+    std::vector<const DTCEntry*> query(const DTCQuery& q) const;
+
+    // Stream entries matching the query into sink, in timestamp order.
+    // Returns the number of entries written. The sink is flushed on return.
+    std::size_t exportTo(const DTCQuery& q, IDTCSink& sink) const;
+
     // Print all entries to stdout.
     void dump() const;
 
+    // Append the full log to a checkpoint image.
+    void saveState(snapshot::SnapshotWriter& out) const;
+
+    // Append only the latest max_entries entries by timestamp, in the same
+    // format, so periodic images stay small however long the log grows.
+    void saveState(snapshot::SnapshotWriter& out, std::size_t max_entries) const;
+
+    // Replace the log with one written by saveState(). Returns false on
+    // malformed input, in which case the log is left unchanged.
+    bool restoreState(snapshot::SnapshotReader& in);
+
 private:
+    // Calls fn(entry) for every entry matching q, in timestamp order.
+    template <typename Fn>
+    std::size_t forEachMatch(const DTCQuery& q, Fn&& fn) const;
+
+    struct Posted {
+        DTC                                        code         = DTC::AEB_SENSOR_FAULT;
+        Severity                                   severity     = Severity::INFO;
+        uint64_t                                   timestamp_ms = 0;
+        std::array<char, kPostedMessageLength + 1> message{};
+    };
+    struct PostBuffer;    // One thread's queue
+    struct PostRegistry;  // Every thread's queue for this manager
+
+    PostBuffer* localBuffer();
+
     std::vector<DTCEntry> entries_;
+    std::vector<uint32_t> time_index_;  // Positions in entries_, sorted by timestamp
+
+    std::unique_ptr<PostRegistry> posts_;
+    std::vector<Posted>           merge_scratch_;
 };
 
 } // namespace diagnostics
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include "adas/diagnostics/DTC.hpp"
+
+namespace adas {
+namespace diagnostics {
+
+// Selection criteria for DTCManager::query() and DTCManager::exportTo().
+// Unset filters match every entry; the time range is inclusive on both ends.
+struct DTCQuery {
+    std::optional<DTC>      code;      // Only entries with this code
+    std::optional<Severity> severity;  // Only entries with this severity
+    uint64_t from_ms = 0;                                     // Earliest timestamp
+    uint64_t to_ms   = std::numeric_limits<uint64_t>::max();  // Latest timestamp
+};
+
+} // namespace diagnostics
+} // namespace adas
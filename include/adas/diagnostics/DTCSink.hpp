@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include "adas/diagnostics/DTCEntry.hpp"
+
+namespace adas {
+namespace diagnostics {
+
+// Destination for entries streamed out of the DTC manager.
+class IDTCSink {
+public:
+    virtual ~IDTCSink() = default;
+
+    // Append one entry to the output.
+    virtual void write(const DTCEntry& entry) = 0;
+
+    // Push any buffered output to the underlying stream.
+    virtual void flush() = 0;
+};
+
+// Base for sinks that encode entries into a memory buffer and hand it to an
+// std::ostream in large blocks, so exporting millions of entries costs a few
+// stream writes instead of one per field.
+class BufferedDTCSink : public IDTCSink {
+public:
+    explicit BufferedDTCSink(std::ostream& out, std::size_t buffer_bytes = 64 * 1024);
+    ~BufferedDTCSink() override;
+
+    void write(const DTCEntry& entry) override;
+    void flush() override;
+
+protected:
+    // Append the encoded form of one entry to buf.
+    virtual void encode(const DTCEntry& entry, std::string& buf) = 0;
+
+    std::string buffer_;
+
+private:
+    std::ostream& out_;
+    std::size_t   buffer_bytes_;
+};
+
+// One JSON object per line:
+//   {"code":"0x1002","severity":"INFO","timestamp_ms":1000,"message":"..."}
+class JsonLinesSink : public BufferedDTCSink {
+public:
+    using BufferedDTCSink::BufferedDTCSink;
+
+protected:
+    void encode(const DTCEntry& entry, std::string& buf) override;
+};
+
+// Comma-separated values with a header row: code,severity,timestamp_ms,message
+class CsvSink : public BufferedDTCSink {
+public:
+    explicit CsvSink(std::ostream& out, std::size_t buffer_bytes = 64 * 1024);
+
+protected:
+    void encode(const DTCEntry& entry, std::string& buf) override;
+};
+
+// Compact little-endian records behind a 5-byte "ADTC" + version header:
+//   u16 code | u8 severity | u64 timestamp_ms | u16 message length | message bytes
+class BinarySink : public BufferedDTCSink {
+public:
+    static constexpr char    kMagic[4] = {'A', 'D', 'T', 'C'};
+    static constexpr uint8_t kVersion  = 1;
+
+    explicit BinarySink(std::ostream& out, std::size_t buffer_bytes = 64 * 1024);
+
+protected:
+    void encode(const DTCEntry& entry, std::string& buf) override;
+};
+
+// Short text label for a severity ("INFO", "WARN", "CRIT").
+const char* severityLabel(Severity severity);
+
+} // namespace diagnostics
+} // namespace adas
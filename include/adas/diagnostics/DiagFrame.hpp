@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "adas/VehicleState.hpp"
+
+namespace adas {
+namespace diagnostics {
+
+struct DtcSummary {
+    uint32_t code         = 0;  // DTC value
+    uint32_t severity     = 0;  // Severity value
+    uint64_t timestamp_ms = 0;
+};
+
+// What a diagnostic tool sees of one AdasManager::execute() cycle.
+// Plain data, published through a Seqlock and sent as is over DiagServer.
+struct DiagFrame {
+    static constexpr std::size_t kMaxFeatures = 8;
+    static constexpr std::size_t kRecentDtcs  = 8;
+
+    uint64_t cycle         = 0;  // Cycles executed before this one
+    uint64_t time_ms       = 0;  // current_time_ms passed to execute()
+    uint32_t cycle_ns      = 0;  // execute() wall time
+    uint32_t shed_level    = 0;  // LoadShedder level
+    uint32_t feature_count = 0;
+    std::array<uint32_t, kMaxFeatures> feature_ns{};  // Execution order; 0 when shed
+    VehicleState state{};                             // Outputs of the cycle
+
+    uint32_t dtc_count    = 0;  // Entries in the DTC log
+    uint32_t recent_count = 0;
+    std::array<DtcSummary, kRecentDtcs> recent{};     // Latest entries, oldest first
+};
+
+} // namespace diagnostics
+} // namespace adas
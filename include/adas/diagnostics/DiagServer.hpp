@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include "adas/common/Seqlock.hpp"
+#include "adas/diagnostics/DiagFrame.hpp"
+
+namespace adas {
+namespace diagnostics {
+
+// Wire format, host byte order (the socket is local):
+//   request  1 byte kDiagRequest
+//   reply    DiagReplyHeader followed by header.size bytes of DiagFrame
+constexpr uint8_t  kDiagRequest = 'S';
+constexpr uint32_t kDiagMagic   = 0x31474441;  // "ADG1"
+
+struct DiagReplyHeader {
+    uint32_t magic   = kDiagMagic;
+    uint32_t size    = sizeof(DiagFrame);
+    uint64_t version = 0;  // Frames published before this one
+};
+
+// Serves the latest DiagFrame over a Unix-domain stream socket from its own
+// thread. The control thread only writes the Seqlock; the server reads it
+// for each request and never blocks the writer. Clients that do not keep up
+// with their replies, or send anything but kDiagRequest, are disconnected.
+class DiagServer {
+public:
+    static constexpr int kMaxClients = 32;
+
+    explicit DiagServer(const common::Seqlock<DiagFrame>& source) : source_(source) {}
+    ~DiagServer() { stop(); }
+
+    DiagServer(const DiagServer&) = delete;
+    DiagServer& operator=(const DiagServer&) = delete;
+
+    // Bind path (replacing a stale socket file) and start serving.
+    // Returns false if the socket cannot be created or the server is running.
+    bool start(const std::string& path);
+
+    // Stop serving and remove the socket file.
+    void stop();
+
+    uint64_t repliesSent() const { return replies_.load(std::memory_order_relaxed); }
+
+private:
+    void serve();
+
+    const common::Seqlock<DiagFrame>& source_;
+    std::string                       path_;
+    int                               listen_fd_ = -1;
+    std::atomic<bool>                 stop_{false};
+    std::atomic<uint64_t>             replies_{0};
+    std::thread                       thread_;
+};
+
+// Blocking client for DiagServer, e.g. for a diagnostic tool or a test.
+class DiagClient {
+public:
+    DiagClient() = default;
+    ~DiagClient() { close(); }
+
+    DiagClient(const DiagClient&) = delete;
+    DiagClient& operator=(const DiagClient&) = delete;
+
+    bool connect(const std::string& path);
+    void close();
+
+    // Request and receive the latest frame. Returns false on a broken
+    // connection or a reply from a different build.
+    bool poll(DiagFrame& frame, uint64_t* version = nullptr);
+
+private:
+    int fd_ = -1;
+};
+
+} // namespace diagnostics
+} // namespace adas
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include "adas/events/EventData.hpp"
+#include "adas/events/EventType.hpp"
+#include "adas/events/IEventSubscriber.hpp"
+#include "adas/VehicleState.hpp"
+
+namespace adas {
+namespace diagnostics {
+
+// Quantile sketch over non-negative values with logarithmic buckets: every
+// quantile is within kRelativeError of a recorded value. Bucket 0 holds
+// values below kMinValue; the last bucket also takes everything above its
+// range. Fixed size, and merge() is exact: merging sketches of two streams
+// gives the same sketch as recording both streams into one.
+class QuantileSketch {
+public:
+    static constexpr std::size_t kBuckets       = 1024;
+    static constexpr double      kRelativeError = 0.01;
+    static constexpr double      kMinValue      = 1e-3;
+
+    void record(double value);
+    void merge(const QuantileSketch& other);
+
+    uint64_t count() const { return count_; }
+    double   min() const { return count_ ? min_ : 0.0; }
+    double   max() const { return count_ ? max_ : 0.0; }
+    double   mean() const { return count_ ? sum_ / count_ : 0.0; }
+
+    // Estimate of the q-quantile (q in [0, 1]), clamped to [min(), max()].
+    double quantile(double q) const;
+
+    const std::array<uint64_t, kBuckets>& buckets() const { return buckets_; }
+
+private:
+    std::array<uint64_t, kBuckets> buckets_{};
+    uint64_t count_ = 0;
+    double   sum_   = 0.0;
+    double   min_   = 0.0;
+    double   max_   = 0.0;
+};
+
+// Plain event counts.
+struct KpiCounters {
+    uint64_t cycles              = 0;  // record() calls
+    uint64_t aeb_active_cycles   = 0;  // brake_requested set
+    uint64_t aeb_activations     = 0;  // brake_requested rising edges
+    uint64_t lka_active_cycles   = 0;  // Non-zero steering correction
+    uint64_t dow_warnings        = 0;  // dow_warning rising edges
+};
+
+// Online KPIs over a run, in constant memory: fed one VehicleState per cycle
+// (plus radar and speed events for time-to-collision) instead of storing
+// them. Aggregators of parallel runs combine exactly with merge().
+class KpiAggregator : public events::IEventSubscriber {
+public:
+    // RADAR_UPDATE and SPEED_UPDATE keep the TTC inputs current.
+    void onEvent(events::EventType type, const events::EventData& data) override;
+
+    // Sample the outputs of one execute() cycle.
+    void record(const VehicleState& state, uint64_t current_time_ms);
+
+    // Add another aggregator's samples. Per-run edge state is not merged.
+    void merge(const KpiAggregator& other);
+
+    const KpiCounters&    counters() const { return counters_; }
+    const QuantileSketch& ttc() const { return ttc_s_; }             // s, while closing on a target
+    const QuantileSketch& accelJerk() const { return jerk_mps3_; }   // |Δaccel/Δt|, m/s³
+    const QuantileSketch& steering() const { return steering_rad_; } // |steering| while LKA acts, rad
+    const QuantileSketch& brakeIntensity() const { return brake_; }  // while AEB brakes
+
+    // Counters and per-sketch summaries as a JSON object.
+    void writeJson(std::ostream& out) const;
+
+private:
+    KpiCounters    counters_;
+    QuantileSketch ttc_s_;
+    QuantileSketch jerk_mps3_;
+    QuantileSketch steering_rad_;
+    QuantileSketch brake_;
+
+    // Latest inputs and previous cycle, for TTC, jerk and rising edges
+    float    distance_m_       = 999.0f;
+    float    target_speed_mps_ = 0.0f;
+    float    ego_speed_mps_    = 0.0f;
+    bool     has_previous_     = false;
+    uint64_t previous_ms_      = 0;
+    float    previous_accel_   = 0.0f;
+    bool     previous_brake_   = false;
+    bool     previous_dow_     = false;
+};
+
+} // namespace diagnostics
+} // namespace adas
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include "adas/events/EventType.hpp"
+#include "adas/VehicleState.hpp"
+
+namespace adas {
+namespace diagnostics {
+
+// Actuator commands whose sensor-to-output latency is tracked.
+enum class Actuator : uint8_t {
+    BRAKE,         // brake_intensity
+    ACCELERATION,  // ego_acceleration
+    STEERING       // steering_angle_rad
+};
+
+const char* toString(Actuator actuator);
+
+// Latency distribution with power-of-two buckets: bucket 0 holds 0 µs,
+// bucket i holds [2^(i-1), 2^i) µs. The last bucket also takes everything
+// above its range. Fixed size, so recording never allocates.
+class LatencyHistogram {
+public:
+    static constexpr std::size_t kBuckets = 32;
+
+    void record(uint64_t latency_us);
+
+    uint64_t count() const { return count_; }
+    uint64_t minUs() const { return count_ ? min_us_ : 0; }
+    uint64_t maxUs() const { return max_us_; }
+    uint64_t meanUs() const { return count_ ? sum_us_ / count_ : 0; }
+
+    // Upper bound of the bucket holding the q-quantile (q in [0, 1]),
+    // clamped to the largest recorded value.
+    uint64_t quantileUs(double q) const;
+
+    const std::array<uint64_t, kBuckets>& buckets() const { return buckets_; }
+
+    // Exclusive upper bound of bucket i in µs.
+    static uint64_t bucketUpperUs(std::size_t i) { return uint64_t{1} << i; }
+
+private:
+    std::array<uint64_t, kBuckets> buckets_{};
+    uint64_t count_  = 0;
+    uint64_t sum_us_ = 0;
+    uint64_t min_us_ = UINT64_MAX;
+    uint64_t max_us_ = 0;
+};
+
+// One latency histogram per path (source sensor event → actuator), e.g.
+// LEAD_UPDATE → BRAKE for the AEB braking path.
+class LatencyTracker {
+public:
+    void record(events::EventType source, Actuator actuator, uint64_t latency_us);
+
+    // Record the age, at now_us, of the inputs behind every actuator command
+    // set in state (see VehicleState::brake_input and friends).
+    void recordOutputs(const VehicleState& state, uint64_t now_us);
+
+    const LatencyHistogram& histogram(events::EventType source, Actuator actuator) const;
+
+    // All paths with at least one sample, as a JSON object keyed by
+    // "SOURCE->ACTUATOR" with summary statistics and bucket counts.
+    void writeJson(std::ostream& out) const;
+
+private:
+    static constexpr std::size_t kSources   = events::kEventTypeCount;
+    static constexpr std::size_t kActuators = 3;
+
+    static std::size_t indexOf(events::EventType source, Actuator actuator) {
+        return static_cast<std::size_t>(source) * kActuators + static_cast<std::size_t>(actuator);
+    }
+
+    std::array<LatencyHistogram, kSources * kActuators> paths_{};
+};
+
+} // namespace diagnostics
+} // namespace adas
@@ -1,25 +1,193 @@
 #pragma once
 
-#include <map>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 #include "adas/events/EventType.hpp"
 #include "adas/events/EventData.hpp"
+#include "adas/events/EventFilter.hpp"
 #include "adas/events/IEventSubscriber.hpp"
 
 namespace adas {
 namespace events {
 
+// Microseconds on std::chrono::steady_clock; the default EventBus clock.
+uint64_t steadyClockUs();
+
+// Delivery urgency of a subscription. Lower values are served first.
+enum class EventPriority : uint8_t {
+    CRITICAL = 0,  // Braking path (AEB)
+    HIGH     = 1,  // Longitudinal control (ACC)
+    NORMAL   = 2,  // Comfort and warning features
+    LOW      = 3
+};
+
+// A subscriber that finished handling an event later than its deadline.
+struct DeadlineMiss {
+    EventType         type;
+    IEventSubscriber* subscriber;
+    uint32_t          latency_us;   // From publish() start to the end of onEvent()
+    uint32_t          deadline_us;
+};
+
 // Routes published events to all subscribers registered for that EventType.
+//
+// Subscribers of one type are served in priority order (registration order
+// within a priority). A subscription may carry a deadline: the time from
+// the start of dispatch to the end of its onEvent() call. Overruns are
+// recorded and collected with takeDeadlineMisses(). It may also carry an
+// EventFilter; events the filter drops never reach onEvent() and do not
+// count against the deadline of later subscribers.
+//
+// publish() and post() stamp each payload with the bus clock
+// (EventStamp::published_us, and acquired_us when the publisher left it 0);
+// a posted event keeps the stamp of its post() when it is delivered.
+// Payloads are taken by value, so a publisher that moves one in pays no copy.
+//
+// Threading: any number of threads may publish() while others subscribe()
+// or unsubscribe(). Each type's subscriber list is immutable once published;
+// changes build a new list and swap it in, and old lists are freed once no
+// publisher can still be reading them (epoch-based reclamation). publish()
+// takes no lock and never retries, except to record a missed deadline.
+// post(), dispatchPending() and setClock() belong to a single control thread.
 class EventBus {
 public:
+    using Clock = std::function<uint64_t()>;
+
+    // Publisher threads tracked at once; further threads still publish
+    // correctly but hold off list reclamation while they do.
+    static constexpr std::size_t kMaxPublisherThreads = 128;
+
+    EventBus();
+    ~EventBus();
+
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    // Time source for payload stamps, e.g. simulation time. Defaults to
+    // steadyClockUs(). Deadlines are always measured on steady_clock.
+    void setClock(Clock now_us);
+    uint64_t now() const { return clock_(); }
+
     // Register a subscriber to receive events of the given type.
-    void subscribe(EventType type, IEventSubscriber* subscriber);
+    // deadline_us = 0 means no deadline. An inactive filter delivers every
+    // event at no cost.
+    void subscribe(EventType type, IEventSubscriber* subscriber,
+                   EventPriority priority = EventPriority::NORMAL,
+                   uint32_t deadline_us = 0,
+                   const EventFilter& filter = EventFilter{});
+
+    // Remove the subscriber from one type, or from every type. Returns the
+    // number of subscriptions removed. Publishes already running on other
+    // threads may still deliver to it; call synchronize() before destroying it.
+    std::size_t unsubscribe(EventType type, IEventSubscriber* subscriber);
+    std::size_t unsubscribe(IEventSubscriber* subscriber);
+
+    // Wait until every publish() that was running on another thread when
+    // this was called has returned, then free the subscriber lists no
+    // publisher can still reach. Must not be called from onEvent().
+    void synchronize();
+
+    std::size_t subscriberCount(EventType type) const;
+
+    // Deliver an event to every subscriber registered for that type, now.
+    void publish(EventType type, EventData data);
+
+    // Queue an event for dispatchPending().
+    void post(EventType type, EventData data);
+
+    // Deliver queued events, most urgent type first (the highest priority of
+    // its subscribers), FIFO within equal urgency. Returns the number delivered.
+    std::size_t dispatchPending();
+
+    std::size_t pendingCount() const { return pending_.size(); }
 
-    // Deliver an event to every subscriber registered for that type.
-    void publish(EventType type, const EventData& data);
+    // Misses recorded since the last call, oldest first.
+    std::vector<DeadlineMiss> takeDeadlineMisses();
+
+    // Total misses recorded over the bus lifetime.
+    uint64_t deadlineMissCount() const { return miss_count_.load(std::memory_order_relaxed); }
+
+    // Replaced subscriber lists not yet freed.
+    std::size_t retiredLists() const;
+
+    // Events dropped by the filters of the subscriber's current
+    // subscriptions, over all types.
+    uint64_t filteredCount(IEventSubscriber* subscriber) const;
+
+    // Make every filter forget its last delivery, e.g. after the subscribers'
+    // state was restored from a snapshot.
+    void resetFilters();
 
 private:
-    std::map<EventType, std::vector<IEventSubscriber*>> subscribers_;
+    struct Subscription {
+        IEventSubscriber*           subscriber;
+        EventPriority               priority;
+        uint32_t                    deadline_us;
+        std::shared_ptr<FilterSlot> filter;  // nullptr: deliver everything
+    };
+    using SubscriberList = std::vector<Subscription>;
+
+    struct Pending {
+        EventPriority priority;
+        uint64_t      sequence;
+        EventType     type;
+        EventData     data;
+    };
+
+    // Orders the pending queue so the most urgent, oldest event is on top.
+    struct LaterFirst {
+        bool operator()(const Pending& a, const Pending& b) const {
+            if (a.priority != b.priority) return a.priority > b.priority;
+            return a.sequence > b.sequence;
+        }
+    };
+
+    // Epoch a publisher thread entered at, 0 while it is outside publish().
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> epoch{0};
+    };
+
+    // Marks the calling thread as reading for its lifetime.
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const EventBus& bus);
+        ~ReadGuard();
+
+    private:
+        const EventBus&        bus_;
+        std::atomic<uint64_t>* slot_;  // nullptr: overflow reader
+        bool                   outer_;
+    };
+
+    EventStamp& stamp(EventData& data) const;
+    void deliver(EventType type, const EventData& data);  // Already stamped
+
+    void replace(EventType type, SubscriberList* list);  // Caller holds write_mutex_
+    void reclaim();                                       // Caller holds write_mutex_
+    uint64_t oldestActiveEpoch() const;                   // UINT64_MAX when none
+
+    Clock clock_ = steadyClockUs;
+
+    std::array<std::atomic<const SubscriberList*>, kEventTypeCount> lists_{};
+    mutable std::array<ReaderSlot, kMaxPublisherThreads>             readers_{};
+    mutable std::atomic<uint64_t>                                    overflow_readers_{0};
+    mutable std::atomic<uint64_t>                                    epoch_{1};
+
+    mutable std::mutex                                          write_mutex_;
+    std::vector<std::pair<uint64_t, const SubscriberList*>>     retired_;  // Retire epoch, list
+
+    std::vector<Pending>      pending_;  // Heap ordered by LaterFirst
+    uint64_t                  next_sequence_ = 0;
+
+    std::mutex                misses_mutex_;
+    std::vector<DeadlineMiss> misses_;
+    std::atomic<uint64_t>     miss_count_{0};
 };
 
 } // namespace events
@@ -1,36 +1,135 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <variant>
 #include <cstdint>
+#include "adas/events/PayloadPool.hpp"
 
 namespace adas {
 namespace events {
 
+// When a payload entered the system. Microseconds on the EventBus clock.
+struct EventStamp {
+    uint64_t acquired_us  = 0;  // Sensor sample time; the bus fills it with published_us if 0
+    uint64_t published_us = 0;  // Set by EventBus::publish()
+};
+
 // Payload for a radar distance measurement event.
 struct RadarData {
     float distance_m       = 0.0f;  // Distance to the vehicle ahead (metres)
     float target_speed_mps = 0.0f;  // Speed of the vehicle ahead (m/s)
     float confidence       = 0.0f;  // Sensor certainty [0.0 – 1.0]
+    EventStamp stamp{};              // Acquisition and publish times
 };
 
 // Payload for an ego vehicle speed update event.
 struct SpeedData {
     float speed_mps = 0.0f;  // Ego vehicle speed (m/s)
+    EventStamp stamp{};       // Acquisition and publish times
 };
 
 // Payload for a lane deviation measurement event.
 struct LaneData {
     float lateral_deviation_m = 0.0f;  // Offset from lane centre (m); +right, -left
     float confidence          = 0.0f;  // Camera certainty [0.0 – 1.0]
+    EventStamp stamp{};                 // Acquisition and publish times
 };
 
 // Payload for a door state change event.
 struct DoorData {
     bool is_open = false;  // True when the door is open
+    EventStamp stamp{};     // Acquisition and publish times
+};
+
+// ── Large camera payloads ────────────────────────────────────────────────────
+// Several KB each, so they live in a PayloadPool and events carry a shared
+// Pooled<> handle: publishing copies the handle, never the payload.
+
+struct LanePoint {
+    float x_m = 0.0f;  // Ahead of the ego (m)
+    float y_m = 0.0f;  // Lateral, +right (m)
+};
+
+// Lane centre lines seen by the camera, ego lane first, as polylines
+// ordered by x.
+struct LanePolyline {
+    static constexpr std::size_t kMaxLanes  = 4;
+    static constexpr std::size_t kMaxPoints = 64;
+
+    uint32_t lane_count = 0;
+    std::array<uint32_t, kMaxLanes>                          point_count{};
+    std::array<std::array<LanePoint, kMaxPoints>, kMaxLanes> points{};
+    std::array<float, kMaxLanes>                             confidence{};
+};
+
+struct Detection {
+    float    x_m        = 0.0f;  // Ahead of the ego (m)
+    float    y_m        = 0.0f;  // Lateral, +right (m)
+    float    vx_mps     = 0.0f;  // Velocity relative to the ego (m/s)
+    float    vy_mps     = 0.0f;
+    float    length_m   = 0.0f;
+    float    width_m    = 0.0f;
+    float    confidence = 0.0f;
+    uint32_t class_id   = 0;
+};
+
+// Objects detected by the camera in one frame.
+struct DetectionList {
+    static constexpr std::size_t kMaxDetections = 256;
+
+    uint32_t                              count = 0;
+    std::array<Detection, kMaxDetections> detections{};
 };
 
-// A single EventData value holds exactly one of the four payload types.
-using EventData = std::variant<RadarData, SpeedData, LaneData, DoorData>;
+// One smoothed object from the tracker, relative to the ego.
+struct Track {
+    uint32_t id     = 0;     // Stable while the object is tracked
+    float    x_m    = 0.0f;  // Ahead of the ego (m)
+    float    y_m    = 0.0f;  // Lateral, +right (m)
+    float    vx_mps = 0.0f;  // Velocity relative to the ego (m/s)
+    float    vy_mps = 0.0f;
+    uint16_t hits   = 0;     // Scans with an associated detection
+    uint16_t misses = 0;     // Consecutive scans without one
+};
+
+// Confirmed tracks after one scan.
+struct TrackList {
+    static constexpr std::size_t kMaxTracks = 256;
+
+    uint32_t                      count = 0;
+    std::array<Track, kMaxTracks> tracks{};
+};
+
+// Payload for a lane geometry event.
+struct LaneGeometryData {
+    Pooled<LanePolyline> lanes;    // Shared, read-only once published
+    EventStamp           stamp{};  // Acquisition and publish times
+};
+
+// Payload for an object list event.
+struct ObjectListData {
+    Pooled<DetectionList> objects;  // Shared, read-only once published
+    EventStamp            stamp{};  // Acquisition and publish times
+};
+
+// Payload for a track list event.
+struct TrackListData {
+    Pooled<TrackList> tracks;   // Shared, read-only once published
+    EventStamp        stamp{};  // Acquisition time of the scan behind the tracks
+};
+
+// A single EventData value holds exactly one of the payload types.
+using EventData = std::variant<RadarData, SpeedData, LaneData, DoorData,
+                               LaneGeometryData, ObjectListData, TrackListData>;
+
+inline EventStamp& stampOf(EventData& data) {
+    return std::visit([](auto& payload) -> EventStamp& { return payload.stamp; }, data);
+}
+
+inline const EventStamp& stampOf(const EventData& data) {
+    return std::visit([](const auto& payload) -> const EventStamp& { return payload.stamp; }, data);
+}
 
 } // namespace events
 } // namespace adas
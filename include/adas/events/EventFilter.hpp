@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "adas/events/EventType.hpp"
+#include "adas/events/EventData.hpp"
+
+namespace adas {
+namespace events {
+
+// Scalar payload fields a deadband can watch.
+enum class FilterField : uint8_t {
+    RADAR_DISTANCE,
+    RADAR_TARGET_SPEED,
+    RADAR_CONFIDENCE,
+    SPEED,
+    LANE_DEVIATION,
+    LANE_CONFIDENCE,
+    DOOR_OPEN           // 0 or 1
+};
+
+// Value of a field in the payload, NaN when the payload does not carry it.
+float fieldValue(const EventData& data, FilterField field);
+
+// A field change smaller than max(absolute, relative * |last delivered|)
+// counts as noise.
+struct Deadband {
+    FilterField field    = FilterField::RADAR_DISTANCE;
+    float       absolute = 0.0f;
+    float       relative = 0.0f;
+};
+
+// Conditions a subscription puts on delivery, checked by the bus before
+// onEvent(). An event is delivered when, in order:
+//   - the predicate, if any, accepts it;
+//   - at least min_interval_us has passed since the last delivery;
+//   - refresh_us has passed since the last delivery, or any deadbanded
+//     field moved out of its band (or there are no deadbands).
+// The first event is always delivered once the predicate accepts it.
+// Times are on the bus clock (EventStamp::published_us).
+struct EventFilter {
+    static constexpr std::size_t kMaxDeadbands = 3;
+
+    // Must be cheap and must not call back into the bus.
+    using Predicate = bool (*)(const void* context, EventType type, const EventData& data);
+
+    std::array<Deadband, kMaxDeadbands> deadbands{};
+    uint8_t     deadband_count  = 0;
+    uint32_t    min_interval_us = 0;        // 0: no rate limit
+    uint32_t    refresh_us      = 0;        // 0: a still value is never re-delivered
+    Predicate   predicate       = nullptr;
+    const void* context         = nullptr;  // Passed to the predicate
+
+    // Appends a deadband; false when all kMaxDeadbands are in use.
+    bool addDeadband(FilterField field, float absolute, float relative = 0.0f);
+
+    bool active() const { return deadband_count > 0 || min_interval_us > 0 || predicate; }
+};
+
+// A filter and what it last let through. Shared by every copy of the
+// subscriber list holding its subscription.
+//
+// State is kept in relaxed atomics so concurrent publishers of one type
+// stay race-free; as with onEvent() itself, such publishers may interleave
+// and both deliver an event that one of them would have dropped alone.
+class FilterSlot {
+public:
+    explicit FilterSlot(const EventFilter& filter) : filter_(filter) {}
+
+    // Decide whether to deliver, and remember the event if so.
+    bool admit(EventType type, const EventData& data, uint64_t now_us);
+
+    // Forget the last delivery, so the next accepted event goes through.
+    void reset() { delivered_.store(false, std::memory_order_relaxed); }
+
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    bool drop() {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    EventFilter                                                filter_;
+    std::atomic<bool>                                          delivered_{false};
+    std::atomic<uint64_t>                                      last_us_{0};
+    std::array<std::atomic<float>, EventFilter::kMaxDeadbands> last_{};
+    std::atomic<uint64_t>                                      dropped_{0};
+};
+
+} // namespace events
+} // namespace adas
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace adas {
 namespace events {
 
@@ -7,11 +9,31 @@ namespace events {
 // Publishers tag each event with one of these values;
 // subscribers filter by type to receive only what they need.
 enum class EventType {
-    RADAR_UPDATE,  // New distance measurement from radar  (consumers: AEB, ACC, DOW)
-    SPEED_UPDATE,  // Ego vehicle speed updated            (consumers: AEB, ACC)
-    LANE_UPDATE,   // Lateral deviation from lane centre   (consumers: LKA)
-    DOOR_UPDATE    // Door open/closed state changed       (consumers: DOW)
+    RADAR_UPDATE,          // New distance measurement from radar  (consumers: tracker, DOW)
+    SPEED_UPDATE,          // Ego vehicle speed updated            (consumers: AEB, ACC, LKA, tracker)
+    LANE_UPDATE,           // Lateral deviation from lane centre   (consumers: LKA)
+    DOOR_UPDATE,           // Door open/closed state changed       (consumers: DOW)
+    LANE_GEOMETRY_UPDATE,  // Camera lane centre lines, pooled    (consumers: LKA)
+    OBJECT_LIST_UPDATE,    // Camera object detections, pooled    (consumers: tracker)
+    TRACK_UPDATE,          // Tracked objects, pooled
+    LEAD_UPDATE            // Tracker's lead target, RadarData     (consumers: AEB, ACC)
 };
 
+constexpr std::size_t kEventTypeCount = static_cast<std::size_t>(EventType::LEAD_UPDATE) + 1;
+
+inline const char* toString(EventType type) {
+    switch (type) {
+        case EventType::RADAR_UPDATE:         return "RADAR_UPDATE";
+        case EventType::SPEED_UPDATE:         return "SPEED_UPDATE";
+        case EventType::LANE_UPDATE:          return "LANE_UPDATE";
+        case EventType::DOOR_UPDATE:          return "DOOR_UPDATE";
+        case EventType::LANE_GEOMETRY_UPDATE: return "LANE_GEOMETRY_UPDATE";
+        case EventType::OBJECT_LIST_UPDATE:   return "OBJECT_LIST_UPDATE";
+        case EventType::TRACK_UPDATE:         return "TRACK_UPDATE";
+        case EventType::LEAD_UPDATE:          return "LEAD_UPDATE";
+    }
+    return "UNKNOWN";
+}
+
 } // namespace events
 } // namespace adas
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace adas {
+namespace events {
+
+template <typename T> class PayloadPool;
+template <typename T> class PooledWriter;
+
+// Shared, read-only handle to a payload slab owned by a PayloadPool.
+// Copying bumps an intrusive reference count: the payload itself is never
+// copied, so a Pooled<T> can travel inside EventData to any number of
+// subscribers. The slab returns to its pool when the last handle is released.
+// The pool must outlive every handle taken from it.
+template <typename T>
+class Pooled {
+public:
+    Pooled() = default;
+    // Share a filled slab; the writer gives up its write access.
+    Pooled(PooledWriter<T>&& writer) noexcept : slab_(std::exchange(writer.slab_, nullptr)) {}
+    Pooled(const Pooled& other) : slab_(other.slab_) { retain(); }
+    Pooled(Pooled&& other) noexcept : slab_(std::exchange(other.slab_, nullptr)) {}
+    Pooled& operator=(Pooled other) noexcept {
+        std::swap(slab_, other.slab_);
+        return *this;
+    }
+    ~Pooled() { release(); }
+
+    explicit operator bool() const { return slab_ != nullptr; }
+
+    const T* get() const { return slab_ ? &slab_->value : nullptr; }
+    const T* operator->() const { return get(); }
+    const T& operator*() const { return slab_->value; }
+
+    // Handles sharing this payload, including this one.
+    uint32_t useCount() const { return slab_ ? slab_->refs.load(std::memory_order_relaxed) : 0; }
+
+private:
+    friend class PayloadPool<T>;
+    friend class PooledWriter<T>;
+    struct Slab {
+        T                     value{};
+        std::atomic<uint32_t> refs{0};
+        PayloadPool<T>*       owner = nullptr;
+        Slab*                 next_free = nullptr;
+    };
+
+    void retain() {
+        if (slab_) slab_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    void release() {
+        if (slab_ && slab_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            slab_->owner->recycle(slab_);
+        }
+        slab_ = nullptr;
+    }
+
+    Slab* slab_ = nullptr;
+};
+
+// Sole, writable handle to a slab fresh from PayloadPool::acquire(). The
+// producer fills it, then converts it to a Pooled<T> to publish.
+template <typename T>
+class PooledWriter {
+public:
+    PooledWriter() = default;
+    PooledWriter(PooledWriter&& other) noexcept : slab_(std::exchange(other.slab_, nullptr)) {}
+    PooledWriter& operator=(PooledWriter other) noexcept {
+        std::swap(slab_, other.slab_);
+        return *this;
+    }
+    ~PooledWriter() {
+        Pooled<T> unpublished(std::move(*this));  // Returns the slab to its pool
+    }
+
+    explicit operator bool() const { return slab_ != nullptr; }
+
+    T* get() const { return slab_ ? &slab_->value : nullptr; }
+    T* operator->() const { return get(); }
+    T& operator*() const { return slab_->value; }
+
+private:
+    friend class Pooled<T>;
+    friend class PayloadPool<T>;
+    using Slab = typename Pooled<T>::Slab;
+
+    explicit PooledWriter(Slab* slab) : slab_(slab) {}
+
+    Slab* slab_ = nullptr;
+};
+
+// Fixed pool of pre-allocated T slabs. acquire() and the final release of a
+// handle never allocate; both may be called from any thread.
+template <typename T>
+class PayloadPool {
+public:
+    explicit PayloadPool(std::size_t capacity)
+        : slabs_(new Slab[capacity]), capacity_(capacity), available_(capacity) {
+        for (std::size_t i = 0; i < capacity; ++i) {
+            slabs_[i].owner     = this;
+            slabs_[i].next_free = (i + 1 < capacity) ? &slabs_[i + 1] : nullptr;
+        }
+        free_ = capacity ? &slabs_[0] : nullptr;
+    }
+    PayloadPool(const PayloadPool&) = delete;
+    PayloadPool& operator=(const PayloadPool&) = delete;
+
+    // A writable handle to a free slab, or an empty handle if every slab is
+    // in use. The slab keeps the contents of its previous use.
+    PooledWriter<T> acquire() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_) {
+            ++exhausted_;
+            return PooledWriter<T>();
+        }
+        Slab* slab = free_;
+        free_      = slab->next_free;
+        --available_;
+        slab->refs.store(1, std::memory_order_relaxed);
+        return PooledWriter<T>(slab);
+    }
+
+    std::size_t capacity() const { return capacity_; }
+    std::size_t available() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return available_;
+    }
+    // acquire() calls that found the pool empty.
+    uint64_t exhaustedCount() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return exhausted_;
+    }
+
+private:
+    friend class Pooled<T>;
+    using Slab = typename Pooled<T>::Slab;
+
+    void recycle(Slab* slab) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        slab->next_free = free_;
+        free_           = slab;
+        ++available_;
+    }
+
+    std::unique_ptr<Slab[]> slabs_;
+    std::size_t             capacity_;
+    mutable std::mutex      mutex_;
+    Slab*                   free_      = nullptr;
+    std::size_t             available_ = 0;
+    uint64_t                exhausted_ = 0;
+};
+
+} // namespace events
+} // namespace adas
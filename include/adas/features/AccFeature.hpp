@@ -1,5 +1,6 @@
 #pragma once
 
+#include "adas/features/Calibration.hpp"
 #include "adas/features/IAdasFeature.hpp"
 
 namespace adas {
@@ -10,13 +11,18 @@ namespace features {
 class AccFeature : public IAdasFeature {
 public:
     // set_speed_mps: desired cruising speed (default 120 km/h = 33.33 m/s)
-    explicit AccFeature(float set_speed_mps = 33.33f);
+    explicit AccFeature(float set_speed_mps = 33.33f,
+                        const AccCalibration& calibration = AccCalibration{});
 
     void onEvent(events::EventType type, const events::EventData& data) override;
     void execute(VehicleState& state,
                  diagnostics::DTCManager& dtc,
                  uint64_t current_time_ms) override;
     const char* name() const override { return "ACC"; }
+    void onSignalTimeout(events::EventType type) override;
+    Criticality criticality(const VehicleState&) const override { return Criticality::CONTROL; }
+    void saveState(snapshot::SnapshotWriter& out) const override;
+    bool restoreState(snapshot::SnapshotReader& in) override;
 
 private:
     float set_speed_mps_;
@@ -26,11 +32,11 @@ private:
     float radar_confidence_ = 0.0f;
     bool  speed_valid_      = false;
 
-    static constexpr float kMinGap        = 30.0f;   // metres
-    static constexpr float kFollowRange   = 150.0f;  // metres — beyond this, free cruise
-    static constexpr float kMaxAccel      = 2.0f;    // m/s²
-    static constexpr float kMaxDecel      = 3.0f;    // m/s²
-    static constexpr float kMinConfidence = 0.6f;
+    // Acquisition times of the latest inputs (µs)
+    uint64_t radar_acquired_us_ = 0;
+    uint64_t speed_acquired_us_ = 0;
+
+    AccCalibration cal_;
 };
 
 } // namespace features
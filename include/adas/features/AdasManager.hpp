@@ -1,33 +1,192 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <vector>
+#include "adas/common/Seqlock.hpp"
 #include "adas/events/EventBus.hpp"
 #include "adas/diagnostics/DTCManager.hpp"
+#include "adas/diagnostics/DiagFrame.hpp"
+#include "adas/diagnostics/KpiAggregator.hpp"
+#include "adas/diagnostics/LatencyTracker.hpp"
+#include "adas/features/Calibration.hpp"
 #include "adas/features/IAdasFeature.hpp"
+#include "adas/features/LoadShedder.hpp"
+#include "adas/features/ShadowRunner.hpp"
+#include "adas/signals/SignalWatchdog.hpp"
+#include "adas/tracking/Tracker.hpp"
 #include "adas/VehicleState.hpp"
 
 namespace adas {
 namespace features {
 
+// A saved image of the manager taken at the end of an execute() cycle.
+struct Checkpoint {
+    uint64_t             time_ms = 0;  // Cycle time the image was taken at
+    std::vector<uint8_t> image;        // Output of AdasManager::saveSnapshot()
+};
+
+// The production feature set (AEB, ACC, LKA, DOW) in execution order.
+// Shadow candidate sets usually start from this with one feature swapped.
+std::vector<std::unique_ptr<IAdasFeature>> makeFeatureSet(const AdasCalibration& calibration);
+
 // Owns all ADAS features and coordinates event routing and execution each cycle.
 class AdasManager {
 public:
-    AdasManager();
+    explicit AdasManager(const AdasCalibration& calibration = AdasCalibration{});
+
+    // The bus holds pointers to members, so a manager stays where it was built.
+    AdasManager(const AdasManager&) = delete;
+    AdasManager& operator=(const AdasManager&) = delete;
 
-    // Publish a sensor event — the EventBus delivers it to subscribed features.
-    void publish(events::EventType type, const events::EventData& data);
+    // Publish a sensor event — the EventBus delivers it to subscribed features
+    // on the calling thread. Input freshness is recorded lock-free and only
+    // applied in execute(), but features' handlers are not synchronized:
+    // threads running alongside execute() should post() instead.
+    void publish(events::EventType type, events::EventData data);
 
-    // Run all features and update the shared vehicle state.
+    // Queue a sensor event; queued events are delivered at the start of the
+    // next execute(), braking-path events first.
+    void post(events::EventType type, events::EventData data);
+
+    // Run all features and update the shared vehicle state. Event deadline
+    // misses since the previous cycle are reported as EVENT_DEADLINE_MISSED.
+    // Radar, lead, speed and lane inputs that stopped arriving are reported as
+    // SIGNAL_TIMEOUT, and their features told to drop the stale values.
+    // With a cycle budget set, low-criticality features may be skipped; a
+    // skipped feature's last outputs are written again in its place.
     void execute(VehicleState& state, uint64_t current_time_ms);
 
     // Access the DTC log after execution.
     const diagnostics::DTCManager& dtcManager() const;
 
+    // Report a DTC from any thread, e.g. a sensor callback. Posted reports
+    // join the log at the end of the next execute(), by timestamp then code.
+    void postDtc(diagnostics::DTC code, diagnostics::Severity severity,
+                 const char* message, uint64_t timestamp_ms);
+
+    // Clock used to stamp events and to age actuator inputs at the end of
+    // execute(). Defaults to steady_clock; simulators may pass sim time.
+    void setClock(events::EventBus::Clock now_us);
+
+    // Sensor-to-actuator latency per path, recorded every execute().
+    const diagnostics::LatencyTracker& latency() const;
+
+    // Object tracker fed by RADAR_UPDATE and OBJECT_LIST_UPDATE. Its lead
+    // track is published as LEAD_UPDATE to AEB and ACC, and its tracks as
+    // TRACK_UPDATE.
+    const tracking::Tracker& tracker() const;
+
+    // Outputs, per-feature timings and latest DTCs of the last execute(),
+    // published without locks: other threads (e.g. a DiagServer) may read it
+    // at any rate.
+    const common::Seqlock<diagnostics::DiagFrame>& diagSnapshot() const;
+
+    // Freshness of a monitored input type (RADAR, LEAD, SPEED, LANE and
+    // LANE_GEOMETRY updates) on the bus clock as of the last execute():
+    // INITIALIZING until its first event, then VALID or TIMEOUT. Types that
+    // are not monitored stay INITIALIZING.
+    signals::SignalStatus inputStatus(events::EventType type) const;
+
+    // Run KPIs (TTC, AEB activations, jerk, steering), sampled every execute().
+    const diagnostics::KpiAggregator& kpis() const;
+
+    // Enable degraded mode: execute() times itself against config.budget_us
+    // and sheds or decimates features by criticality. Level changes are
+    // reported as LOAD_SHED_ACTIVE / LOAD_SHED_RELEASED.
+    void setLoadShedding(const LoadShedConfig& config);
+    const LoadShedder& loadShedder() const;
+
+    // Run candidates in shadow mode on a worker thread: they see every event
+    // production sees, run after every execute(), and their outputs are
+    // compared with production's. Production outputs are never affected.
+    // Returns false if a shadow is already running.
+    bool enableShadow(std::vector<std::unique_ptr<IAdasFeature>> candidates,
+                      const ShadowConfig& config = ShadowConfig{});
+
+    // Detach the shadow and join its worker, e.g. to start a different
+    // candidate. Returns false if none is running.
+    bool disableShadow();
+
+    // The running shadow, or nullptr.
+    const ShadowRunner* shadow() const;
+
+    // Compact binary image of every feature's internal state, the tracker's
+    // track table and the DTC log.
+    std::vector<uint8_t> saveSnapshot() const;
+
+    // Load an image produced by saveSnapshot() on a manager with the same
+    // feature set. Returns false, leaving the manager unchanged, if the image
+    // is malformed or does not match.
+    bool restoreSnapshot(const std::vector<uint8_t>& image);
+
+    static constexpr std::size_t kDefaultMaxCheckpoints = 64;
+    // DTC entries kept in each checkpoint: the latest by timestamp.
+    static constexpr std::size_t kCheckpointDtcEntries = 256;
+
+    // Take a checkpoint after execute() whenever at least interval_ms has
+    // passed since the previous one. 0 (the default) disables checkpointing.
+    // Only the latest max_checkpoints (at least 1) are kept; older ones are
+    // dropped as new ones are taken. A checkpoint is taken after the cycle's
+    // time is measured, so it never counts against the load-shedding budget,
+    // and holds only the last kCheckpointDtcEntries DTCs.
+    void setCheckpointInterval(uint64_t interval_ms,
+                               std::size_t max_checkpoints = kDefaultMaxCheckpoints);
+
+    // Checkpoints kept, oldest first.
+    const std::deque<Checkpoint>& checkpoints() const;
+
+    // Latest checkpoint taken at or before time_ms, or nullptr if there is none.
+    const Checkpoint* nearestCheckpoint(uint64_t time_ms) const;
+
 private:
+    std::vector<uint8_t> saveSnapshot(std::size_t max_dtc_entries) const;
+    void reportDeadlineMisses(uint64_t current_time_ms);
+    void reportShedChange(int change, uint64_t cycle_ns, uint64_t current_time_ms);
+    void publishDiagFrame(const VehicleState& state, uint64_t current_time_ms, uint64_t cycle_ns);
+    void checkInputs(uint64_t current_time_ms);
+
+    // Records the newest sample of each monitored input from the bus, on
+    // whichever thread published it, so inputs republished by the tracker
+    // count too. checkInputs() feeds them to the watchdog.
+    class InputMonitor : public events::IEventSubscriber {
+    public:
+        explicit InputMonitor(AdasManager& manager) : manager_(manager) {}
+        void onEvent(events::EventType type, const events::EventData& data) override;
+
+    private:
+        AdasManager& manager_;
+    };
+
     events::EventBus                             event_bus_;
     diagnostics::DTCManager                      dtc_manager_;
+    diagnostics::LatencyTracker                  latency_;
+    diagnostics::KpiAggregator                   kpis_;
+    tracking::Tracker                            tracker_;
+    LoadShedder                                  load_shedder_;
+    uint64_t                                     cycle_count_ = 0;
     std::vector<std::unique_ptr<IAdasFeature>>   features_;
+    std::vector<uint32_t>                        feature_ns_;  // Last execute() per feature
+    common::Seqlock<diagnostics::DiagFrame>      diag_;
+
+    // ── Input freshness ──
+    static constexpr signals::SignalId kUnmonitored = UINT32_MAX;
+    signals::SignalWatchdog                                watchdog_;
+    InputMonitor                                           input_monitor_{*this};
+    std::array<signals::SignalId, events::kEventTypeCount> input_ids_;           // By EventType
+    std::vector<events::EventType>                         input_types_;         // By SignalId
+    uint32_t                                               timed_out_mask_ = 0;  // EventType bits
+    // Newest sample time + 1 (ms) by EventType since the last cycle; 0 = none
+    std::array<std::atomic<uint64_t>, events::kEventTypeCount> fed_ms_{};
+
+    uint64_t               checkpoint_interval_ms_ = 0;
+    std::size_t            max_checkpoints_        = kDefaultMaxCheckpoints;
+    std::deque<Checkpoint> checkpoints_;
+
+    // Declared last: stopped and joined before anything it observes goes away
+    std::unique_ptr<ShadowRunner> shadow_;
 };
 
 } // namespace features
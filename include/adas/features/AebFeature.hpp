@@ -1,5 +1,6 @@
 #pragma once
 
+#include "adas/features/Calibration.hpp"
 #include "adas/features/IAdasFeature.hpp"
 
 namespace adas {
@@ -9,11 +10,17 @@ namespace features {
 // the Time-To-Collision (TTC) with the vehicle ahead drops below safe thresholds.
 class AebFeature : public IAdasFeature {
 public:
+    explicit AebFeature(const AebCalibration& calibration = AebCalibration{});
+
     void onEvent(events::EventType type, const events::EventData& data) override;
     void execute(VehicleState& state,
                  diagnostics::DTCManager& dtc,
                  uint64_t current_time_ms) override;
     const char* name() const override { return "AEB"; }
+    void onSignalTimeout(events::EventType type) override;
+    Criticality criticality(const VehicleState&) const override { return Criticality::SAFETY; }
+    void saveState(snapshot::SnapshotWriter& out) const override;
+    bool restoreState(snapshot::SnapshotReader& in) override;
 
 private:
     float distance_m_       = 999.0f;
@@ -22,9 +29,11 @@ private:
     float radar_confidence_ = 0.0f;
     bool  speed_valid_      = false;
 
-    static constexpr float kFullBrakeTtc    = 1.5f;  // seconds
-    static constexpr float kPartialBrakeTtc = 3.0f;  // seconds
-    static constexpr float kMinConfidence   = 0.6f;
+    // Acquisition times of the latest inputs (µs)
+    uint64_t radar_acquired_us_ = 0;
+    uint64_t speed_acquired_us_ = 0;
+
+    AebCalibration cal_;
 };
 
 } // namespace features
@@ -0,0 +1,50 @@
+#pragma once
+
+namespace adas {
+namespace features {
+
+// Tunable thresholds for Automatic Emergency Braking.
+// Defaults are the production calibration.
+struct AebCalibration {
+    float full_brake_ttc_s    = 1.5f;  // TTC below which full braking is applied (s)
+    float partial_brake_ttc_s = 3.0f;  // TTC below which partial braking starts (s)
+    float min_confidence      = 0.6f;  // Minimum radar confidence to act on
+};
+
+// Tunable gains and limits for Adaptive Cruise Control.
+struct AccCalibration {
+    float min_gap_m      = 30.0f;   // Gap below which ACC matches the target's speed (m)
+    float follow_range_m = 150.0f;  // Beyond this, free cruise (m)
+    float gap_gain       = 0.5f;    // Extra speed allowed per metre of gap surplus (1/s)
+    float speed_gain     = 0.3f;    // Acceleration per m/s of speed error (1/s)
+    float max_accel_mps2 = 2.0f;    // Acceleration limit (m/s²)
+    float max_decel_mps2 = 3.0f;    // Deceleration limit (m/s²)
+    float min_confidence = 0.6f;    // Minimum radar confidence to follow a target
+};
+
+// Proportional steering limits for Lane Keep Assist.
+struct LkaCalibration {
+    float deviation_threshold_m = 0.3f;  // Deviation tolerated before steering (m)
+    float steering_gain         = 0.5f;  // Steering per metre of deviation (rad/m)
+    float max_steering_rad      = 0.5f;  // Steering correction limit (rad)
+    float min_confidence        = 0.6f;  // Minimum camera confidence to act on
+    float lookahead_s           = 0.0f;  // Preview time on lane geometry; 0 steers on the current offset
+};
+
+// Warning zone for Door Open Warning.
+struct DowCalibration {
+    float warning_distance_m = 15.0f;  // Rear gap below which an approach is warned (m)
+    float min_target_speed   = 0.5f;   // Slower objects are treated as stationary (m/s)
+    float min_confidence     = 0.6f;   // Minimum radar confidence to act on
+};
+
+// Calibration for every feature owned by AdasManager.
+struct AdasCalibration {
+    AebCalibration aeb;
+    AccCalibration acc;
+    LkaCalibration lka;
+    DowCalibration dow;
+};
+
+} // namespace features
+} // namespace adas
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "adas/features/Calibration.hpp"
+
+namespace adas {
+namespace features {
+
+// Stateless control laws over structure-of-arrays batches of N vehicles.
+// The features call these with N = 1 and FleetManager with the whole fleet,
+// so the batch and the per-object paths share one implementation. Loops are branch-free so the
+// compiler can vectorise them; input and output arrays must not overlap.
+
+// Outcome of the AEB decision for one vehicle.
+enum class AebLevel : uint8_t {
+    SENSOR_FAULT = 0,  // Speed not yet valid or radar confidence too low
+    NONE         = 1,  // No collision risk within the partial-brake TTC
+    PARTIAL      = 2,  // Brake intensity scaled between the two TTC thresholds
+    FULL         = 3   // Full emergency brake
+};
+
+struct AebBatchInput {
+    const float*   distance_m;        // Radar distance to the vehicle ahead (m)
+    const float*   target_speed_mps;  // Speed of the vehicle ahead (m/s)
+    const float*   ego_speed_mps;     // Ego speed (m/s)
+    const float*   radar_confidence;  // Radar confidence [0.0 – 1.0]
+    const uint8_t* speed_valid;       // Non-zero once an ego speed has been received
+};
+
+struct AebBatchOutput {
+    float*   brake_intensity;  // [0.0 – 1.0]; 0 unless level is PARTIAL or FULL
+    uint8_t* level;            // AebLevel
+};
+
+// Time-To-Collision braking decision for n vehicles.
+void computeAebBatch(const AebBatchInput& in, const AebBatchOutput& out,
+                     std::size_t n, const AebCalibration& cal);
+
+struct AccBatchInput {
+    const float*   ego_speed_mps;     // Ego speed (m/s)
+    const float*   set_speed_mps;     // Driver-set cruise speed (m/s)
+    const float*   distance_m;        // Radar distance to the vehicle ahead (m)
+    const float*   target_speed_mps;  // Speed of the vehicle ahead (m/s)
+    const float*   radar_confidence;  // Radar confidence [0.0 – 1.0]
+    const uint8_t* speed_valid;       // Non-zero once an ego speed has been received
+};
+
+struct AccBatchOutput {
+    float*   acceleration;  // Commanded acceleration (m/s²); 0 when inactive
+    uint8_t* active;        // 0 when the speed signal is not ready (sensor fault)
+};
+
+// Gap-controlled cruise acceleration for n vehicles.
+void computeAccBatch(const AccBatchInput& in, const AccBatchOutput& out,
+                     std::size_t n, const AccCalibration& cal);
+
+// Outcome of the LKA decision for one vehicle.
+enum class LkaStatus : uint8_t {
+    LOW_CONFIDENCE = 0,  // Camera confidence below calibration
+    INACTIVE       = 1,  // Within the deviation threshold
+    ACTIVE         = 2   // Steering correction applied
+};
+
+struct LkaBatchInput {
+    const float* lateral_deviation_m;  // Offset from lane centre (m)
+    const float* confidence;           // Camera confidence [0.0 – 1.0]
+};
+
+struct LkaBatchOutput {
+    float*   steering_rad;  // Correction (rad); 0 unless status is ACTIVE
+    uint8_t* status;        // LkaStatus
+};
+
+// Proportional lane-centring correction for n vehicles.
+void computeLkaBatch(const LkaBatchInput& in, const LkaBatchOutput& out,
+                     std::size_t n, const LkaCalibration& cal);
+
+// Outcome of the DOW decision for one vehicle.
+enum class DowLevel : uint8_t {
+    DOOR_CLOSED  = 0,
+    SENSOR_FAULT = 1,  // Door open, radar confidence too low
+    CLEAR        = 2,  // Door open, nothing approaching
+    WARNING      = 3   // Door open, object approaching within the warning distance
+};
+
+struct DowBatchInput {
+    const float*   distance_m;        // Rear radar distance (m)
+    const float*   target_speed_mps;  // Speed of the approaching object (m/s)
+    const float*   radar_confidence;  // Radar confidence [0.0 – 1.0]
+    const uint8_t* door_open;         // Non-zero while a door is open
+};
+
+// Door-open warning decision for n vehicles; writes DowLevel values.
+void computeDowBatch(const DowBatchInput& in, uint8_t* level,
+                     std::size_t n, const DowCalibration& cal);
+
+} // namespace features
+} // namespace adas
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "adas/events/EventFilter.hpp"
+#include "adas/features/Calibration.hpp"
 #include "adas/features/IAdasFeature.hpp"
 
 namespace adas {
@@ -9,21 +11,39 @@ namespace features {
 // from behind while a door is open (e.g. when parked on a roadside).
 class DowFeature : public IAdasFeature {
 public:
+    explicit DowFeature(const DowCalibration& calibration = DowCalibration{});
+
     void onEvent(events::EventType type, const events::EventData& data) override;
     void execute(VehicleState& state,
                  diagnostics::DTCManager& dtc,
                  uint64_t current_time_ms) override;
     const char* name() const override { return "DOW"; }
+    void onSignalTimeout(events::EventType type) override;
+    // Guards the door at standstill; a convenience while moving.
+    Criticality criticality(const VehicleState& state) const override {
+        return (state.ego_speed_mps > kMovingSpeed) ? Criticality::CONVENIENCE : Criticality::SAFETY;
+    }
+    void replayOutputs(VehicleState& state) const override { state.dow_warning = warning_; }
+    void saveState(snapshot::SnapshotWriter& out) const override;
+    bool restoreState(snapshot::SnapshotReader& in) override;
+
+    // RADAR_UPDATE filter that passes a report only when it would change
+    // the warning decision: the confidence, distance or target speed
+    // crosses its calibrated threshold. The held values may go stale inside
+    // their bands, but the warning level always matches the latest report.
+    events::EventFilter radarFilter() const;
 
 private:
+    bool changesDecision(const events::RadarData& r) const;
+
     float distance_m_       = 999.0f;
     float target_speed_mps_ = 0.0f;
     float radar_confidence_ = 0.0f;
     bool  door_open_        = false;
+    bool  warning_          = false;  // Decision of the last execute()
+    DowCalibration cal_;
 
-    static constexpr float kWarningDistance = 15.0f;   // metres
-    static constexpr float kMinTargetSpeed  = 0.5f;    // m/s — ignore stationary objects
-    static constexpr float kMinConfidence   = 0.6f;
+    static constexpr float kMovingSpeed = 0.5f;  // m/s
 };
 
 } // namespace features
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "adas/diagnostics/DTCManager.hpp"
+#include "adas/events/EventData.hpp"
+#include "adas/events/EventType.hpp"
+#include "adas/features/Calibration.hpp"
+#include "adas/VehicleState.hpp"
+
+namespace adas {
+namespace features {
+
+// Index of a vehicle in a FleetManager. Stable for the fleet's lifetime.
+using VehicleId = uint32_t;
+
+// Runs the AdasManager feature set for many vehicles at once.
+//
+// Per-vehicle feature state is stored as structure-of-arrays (every
+// vehicle's radar distance side by side, and so on), and one execute() runs
+// each control kernel over the whole fleet. Inputs read by several features,
+// such as the radar target, are stored once. There is no EventBus: events
+// are written straight into the addressed vehicle's slots.
+//
+// Differences from AdasManager: all vehicles share one calibration and one
+// DTC log, and DTCs are reported when a condition starts rather than every
+// cycle it holds, with the vehicle id in the description. There is no
+// tracker either: each radar report is taken as AEB and ACC's lead target,
+// as AdasManager does once its tracker has confirmed that target.
+class FleetManager {
+public:
+    explicit FleetManager(const AdasCalibration& calibration = AdasCalibration{});
+
+    // Add a vehicle with the given ACC set speed. Returns its id.
+    VehicleId addVehicle(float set_speed_mps = 33.33f);
+
+    void        reserve(std::size_t vehicles);
+    std::size_t size() const { return distance_m_.size(); }
+
+    // Deliver a sensor event to one vehicle. Camera payloads are ignored.
+    // Returns false, changing nothing, if no vehicle has that id.
+    bool publish(VehicleId id, events::EventType type, const events::EventData& data);
+
+    // Run every feature for every vehicle.
+    void execute(uint64_t current_time_ms);
+
+    // Outputs of the latest execute() for one vehicle. Returns false if no
+    // vehicle has that id.
+    bool state(VehicleId id, VehicleState& out) const;
+
+    // Whole-fleet output arrays, indexed by VehicleId.
+    const std::vector<float>&   brakeIntensity() const { return brake_intensity_; }
+    const std::vector<float>&   acceleration() const { return acceleration_; }
+    const std::vector<float>&   steering() const { return steering_rad_; }
+    const std::vector<uint8_t>& aebLevel() const { return aeb_level_; }    // AebLevel
+    const std::vector<uint8_t>& dowLevel() const { return dow_level_; }    // DowLevel
+
+    const diagnostics::DTCManager& dtcManager() const { return dtc_manager_; }
+
+    // Bytes of per-vehicle state across all arrays.
+    static constexpr std::size_t kBytesPerVehicle =
+        10 * sizeof(float) + 3 * sizeof(uint64_t) + 7 * sizeof(uint8_t);
+
+private:
+    void reportFaults(uint64_t current_time_ms);
+
+    AdasCalibration         cal_;
+    diagnostics::DTCManager dtc_manager_;
+
+    // ── Inputs ──
+    std::vector<float>    distance_m_;           // Radar (AEB, ACC, DOW)
+    std::vector<float>    target_speed_mps_;
+    std::vector<float>    radar_confidence_;
+    std::vector<float>    ego_speed_mps_;        // Speed (AEB, ACC)
+    std::vector<uint8_t>  speed_valid_;
+    std::vector<float>    set_speed_mps_;        // ACC
+    std::vector<float>    lateral_deviation_m_;  // Lane (LKA)
+    std::vector<float>    lane_confidence_;
+    std::vector<uint8_t>  door_open_;            // Door (DOW)
+    std::vector<uint64_t> radar_acquired_us_;
+    std::vector<uint64_t> speed_acquired_us_;
+    std::vector<uint64_t> lane_acquired_us_;
+
+    // ── Outputs ──
+    std::vector<float>   brake_intensity_;
+    std::vector<uint8_t> aeb_level_;
+    std::vector<float>   acceleration_;
+    std::vector<uint8_t> acc_active_;
+    std::vector<float>   steering_rad_;
+    std::vector<uint8_t> lka_status_;
+    std::vector<uint8_t> dow_level_;
+    std::vector<uint8_t> faults_;  // DTC conditions active last cycle, one bit each
+};
+
+} // namespace features
+} // namespace adas
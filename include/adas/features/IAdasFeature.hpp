@@ -3,10 +3,20 @@
 #include "adas/events/IEventSubscriber.hpp"
 #include "adas/VehicleState.hpp"
 #include "adas/diagnostics/DTCManager.hpp"
+#include "adas/snapshot/Snapshot.hpp"
 
 namespace adas {
 namespace features {
 
+// How much a feature matters to safety right now. Under CPU overload the
+// manager sheds the least critical classes first (see LoadShedder).
+enum class Criticality : uint8_t {
+    SAFETY      = 0,  // Never shed (AEB)
+    CONTROL     = 1,  // Vehicle control (ACC)
+    ASSIST      = 2,  // Driver assistance (LKA)
+    CONVENIENCE = 3   // First to go (DOW while moving)
+};
+
 // Base interface for all ADAS features.
 // Each feature subscribes to relevant events and acts on VehicleState each cycle.
 class IAdasFeature : public events::IEventSubscriber {
@@ -20,6 +30,25 @@ public:
 
     // Human-readable name used for logging.
     virtual const char* name() const = 0;
+
+    // A monitored input of this type stopped arriving. Features drop what
+    // they last received from it rather than act on stale values; the next
+    // event of the type restores them. Called before execute().
+    virtual void onSignalTimeout(events::EventType /*type*/) {}
+
+    // Criticality class for this cycle's state.
+    virtual Criticality criticality(const VehicleState& state) const = 0;
+
+    // Write the outputs of the last execute() again, input stamps included,
+    // on a cycle the load shedder skips this feature. Features that can be
+    // skipped override this so their commands hold instead of pulsing.
+    virtual void replayOutputs(VehicleState& /*state*/) const {}
+
+    // Append the feature's internal state to a checkpoint image.
+    virtual void saveState(snapshot::SnapshotWriter& out) const = 0;
+
+    // Restore state written by saveState(). Returns false on malformed input.
+    virtual bool restoreState(snapshot::SnapshotReader& in) = 0;
 };
 
 } // namespace features
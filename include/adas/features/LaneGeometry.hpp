@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "adas/events/EventData.hpp"
+#include "adas/snapshot/Snapshot.hpp"
+
+namespace adas {
+namespace features {
+
+// Position and direction on a lane centre line, in the ego frame.
+struct LanePose {
+    float x_m         = 0.0f;  // Ahead of the ego (m)
+    float y_m         = 0.0f;  // Lateral, +right (m)
+    float heading_rad = 0.0f;  // Direction to the ego's x axis, +right
+};
+
+// A lane centre line resampled at uniform arc length.
+//
+// build() costs O(polyline points) once per camera frame; afterwards every
+// query works on a fixed number of samples, so its cost does not depend on
+// how long or finely sampled the source polyline was. Samples are stored
+// as separate x / y / heading arrays.
+class LaneGeometry {
+public:
+    static constexpr std::size_t kSamples = 128;
+
+    // Resample a centre line ordered by increasing x. Needs at least two
+    // points spanning a non-zero length; otherwise the geometry becomes invalid.
+    bool build(const events::LanePoint* points, std::size_t count);
+
+    bool  valid() const { return samples_ >= 2; }
+    float length() const { return length_m_; }
+
+    // Pose at arc length s. Beyond either end the line is extended along
+    // its end tangent.
+    LanePose at(float s_m) const;
+
+    // Arc length of the centre-line point nearest (x, y).
+    float nearest(float x_m, float y_m) const;
+
+    // Signed lateral offset of the point (x, y) from the centre line, +right.
+    float offsetOf(float x_m, float y_m, float s_m) const;
+
+    // Lateral deviation, +right, the ego will have after driving straight
+    // ahead for distance_m: the LKA preview deviation.
+    float previewDeviation(float distance_m) const;
+
+    void save(snapshot::SnapshotWriter& out) const;
+    bool restore(snapshot::SnapshotReader& in);
+
+private:
+    uint32_t                    samples_  = 0;
+    float                       ds_m_     = 0.0f;
+    float                       length_m_ = 0.0f;
+    std::array<float, kSamples> x_{};
+    std::array<float, kSamples> y_{};
+    std::array<float, kSamples> heading_{};
+};
+
+} // namespace features
+} // namespace adas
@@ -1,28 +1,48 @@
 #pragma once
 
+#include "adas/features/Calibration.hpp"
 #include "adas/features/IAdasFeature.hpp"
+#include "adas/features/LaneGeometry.hpp"
 
 namespace adas {
 namespace features {
 
 // Lane Keep Assist — applies a proportional steering correction when the vehicle
 // drifts more than a set threshold from the lane centre.
+// It steers on whichever of LANE_UPDATE and LANE_GEOMETRY_UPDATE was acquired
+// last: the offset of the former, or the preview deviation lookahead_s ahead
+// at the current speed along the latter's centre line.
 class LkaFeature : public IAdasFeature {
 public:
+    explicit LkaFeature(const LkaCalibration& calibration = LkaCalibration{});
+
     void onEvent(events::EventType type, const events::EventData& data) override;
     void execute(VehicleState& state,
                  diagnostics::DTCManager& dtc,
                  uint64_t current_time_ms) override;
     const char* name() const override { return "LKA"; }
+    void onSignalTimeout(events::EventType type) override;
+    Criticality criticality(const VehicleState&) const override { return Criticality::ASSIST; }
+    void replayOutputs(VehicleState& state) const override;
+    void saveState(snapshot::SnapshotWriter& out) const override;
+    bool restoreState(snapshot::SnapshotReader& in) override;
 
 private:
     float lateral_deviation_m_ = 0.0f;
     float confidence_          = 0.0f;
+    uint64_t lane_acquired_us_ = 0;     // Acquisition time of the latest input (µs)
+    LkaCalibration cal_;
+
+    // Preview from lane geometry
+    LaneGeometry geometry_;
+    float        geometry_confidence_  = 0.0f;
+    uint64_t     geometry_acquired_us_ = 0;
+    float        ego_speed_mps_        = 0.0f;
 
-    static constexpr float kDeviationThreshold = 0.3f;   // metres
-    static constexpr float kSteeringGain       = 0.5f;   // rad/m
-    static constexpr float kMaxSteering        = 0.5f;   // rad
-    static constexpr float kMinConfidence      = 0.6f;
+    // Outputs of the last execute(), replayed on skipped cycles
+    bool       steering_held_ = false;
+    float      held_steering_ = 0.0f;
+    InputStamp held_input_;
 };
 
 } // namespace features
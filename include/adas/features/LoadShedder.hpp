@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include "adas/features/IAdasFeature.hpp"
+
+namespace adas {
+namespace features {
+
+// Cycle-time budget and hysteresis for degraded mode.
+struct LoadShedConfig {
+    uint32_t budget_us      = 0;      // Cycle budget; 0 disables shedding
+    float    shed_ratio     = 0.8f;   // Escalate when a cycle takes more than this share of budget
+    float    restore_ratio  = 0.5f;   // Cycles below this share of budget count as calm
+    uint32_t restore_cycles = 10;     // Consecutive calm cycles needed to step back one level
+    uint32_t decimation     = 4;      // A decimated feature runs one cycle in this many
+};
+
+// Decides which criticality classes run each cycle.
+//
+// Level 0 runs everything. Each overrunning cycle escalates one level;
+// restore_cycles calm cycles in a row step back one level:
+//
+//   level   SAFETY  CONTROL  ASSIST     CONVENIENCE
+//   0       run     run      run        run
+//   1       run     run      run        decimate
+//   2       run     run      decimate   shed
+//   3       run     run      shed       shed
+class LoadShedder {
+public:
+    static constexpr uint8_t kMaxLevel = 3;
+
+    explicit LoadShedder(const LoadShedConfig& config = LoadShedConfig{}) : config_(config) {}
+
+    // Feed the measured duration of the cycle that just finished.
+    // Returns the level change: +1, -1 or 0.
+    int update(uint64_t cycle_ns);
+
+    // Whether a feature of the given class runs in cycle number `cycle`.
+    bool shouldRun(Criticality criticality, uint64_t cycle) const;
+
+    uint8_t               level() const { return level_; }
+    const LoadShedConfig& config() const { return config_; }
+
+private:
+    LoadShedConfig config_;
+    uint8_t        level_       = 0;
+    uint32_t       calm_cycles_ = 0;
+};
+
+} // namespace features
+} // namespace adas
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "adas/common/MpscQueue.hpp"
+#include "adas/diagnostics/DTCManager.hpp"
+#include "adas/events/EventData.hpp"
+#include "adas/events/EventType.hpp"
+#include "adas/events/IEventSubscriber.hpp"
+#include "adas/features/IAdasFeature.hpp"
+#include "adas/VehicleState.hpp"
+
+namespace adas {
+namespace features {
+
+struct ShadowConfig {
+    std::size_t queue_capacity         = 4096;    // Events and cycle marks in flight
+    std::size_t max_divergences        = 1024;    // Logged; later ones are only counted
+    float       brake_tolerance        = 0.01f;   // brake_intensity
+    float       acceleration_tolerance = 0.05f;   // m/s²
+    float       steering_tolerance     = 0.002f;  // rad
+};
+
+enum class ShadowField : uint8_t {
+    BRAKE_REQUESTED,
+    BRAKE_INTENSITY,
+    ACCELERATION,
+    STEERING,
+    DOW_WARNING
+};
+
+// One actuator output on which the candidates disagreed with production.
+struct ShadowDivergence {
+    uint64_t    time_ms;
+    ShadowField field;
+    float       production;
+    float       candidate;
+};
+
+// Cost on the publishing threads.
+struct ShadowStats {
+    uint64_t enqueued         = 0;  // Events and cycle marks handed to the worker
+    uint64_t dropped          = 0;  // Queue full: the shadow has fallen behind
+    uint64_t total_enqueue_ns = 0;
+    uint64_t max_enqueue_ns   = 0;
+};
+
+// Runs a candidate feature set on a worker thread next to production.
+//
+// Subscribed to every event type, it copies each event into a lock-free
+// multi-producer queue; AdasManager adds a cycle mark with the production
+// outputs after execute(). The worker replays the events into the candidates,
+// runs them at each mark, and logs every actuator output that differs from
+// production by more than its tolerance. A publisher only ever does one
+// non-blocking enqueue per event or cycle; if the worker falls behind, items
+// are dropped and counted, and the candidates may drift. The bus lets any
+// thread publish; concurrent publishers never wait for one another.
+//
+// The candidates' own DTC reports are not compared and are discarded after
+// every cycle.
+class ShadowRunner : public events::IEventSubscriber {
+public:
+    explicit ShadowRunner(std::vector<std::unique_ptr<IAdasFeature>> candidates,
+                          const ShadowConfig& config = ShadowConfig{});
+    ~ShadowRunner() override;
+
+    ShadowRunner(const ShadowRunner&) = delete;
+    ShadowRunner& operator=(const ShadowRunner&) = delete;
+
+    // Publishing threads.
+    void onEvent(events::EventType type, const events::EventData& data) override;
+    void endCycle(const VehicleState& production, uint64_t current_time_ms);
+
+    // Block until the worker has processed everything enqueued so far.
+    void drain() const;
+
+    // Any thread.
+    ShadowStats stats() const;
+    uint64_t cyclesCompared() const { return cycles_.load(std::memory_order_acquire); }
+    uint64_t divergentCycles() const { return divergent_cycles_.load(std::memory_order_acquire); }
+    std::vector<ShadowDivergence> divergences() const;
+
+private:
+    struct Item {
+        bool              cycle = false;  // Cycle mark rather than an event
+        events::EventType type  = events::EventType::RADAR_UPDATE;
+        events::EventData data;
+        VehicleState      production;
+        uint64_t          time_ms = 0;
+    };
+
+    void enqueue(Item item);
+    void run();
+    void runCycle(const VehicleState& production, uint64_t time_ms);
+    void compare(const VehicleState& production, const VehicleState& candidate, uint64_t time_ms);
+
+    ShadowConfig                               cfg_;
+    std::vector<std::unique_ptr<IAdasFeature>> candidates_;  // Worker thread only
+    diagnostics::DTCManager                    dtc_;         // Worker thread only
+    common::MpscQueue<Item>                    queue_;
+
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> total_enqueue_ns_{0};
+    std::atomic<uint64_t> max_enqueue_ns_{0};
+
+    std::atomic<uint64_t> processed_{0};
+    std::atomic<uint64_t> cycles_{0};
+    std::atomic<uint64_t> divergent_cycles_{0};
+    std::atomic<bool>     stop_{false};
+
+    mutable std::mutex            log_mutex_;
+    std::vector<ShadowDivergence> log_;
+
+    std::thread worker_;  // Last: starts after everything above is built
+};
+
+} // namespace features
+} // namespace adas
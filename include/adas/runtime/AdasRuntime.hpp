@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include "adas/diagnostics/LatencyTracker.hpp"
+#include "adas/features/AdasManager.hpp"
+#include "adas/VehicleState.hpp"
+
+namespace adas {
+namespace runtime {
+
+struct RuntimeConfig {
+    uint32_t period_us     = 10000;  // Cycle period
+    int      cpu           = -1;     // Pin the loop thread to this CPU; -1 = no pinning
+    int      fifo_priority = 0;      // SCHED_FIFO priority (1–99); 0 = keep the default policy
+};
+
+// What applyThreadSettings() managed to apply. Without the privileges for
+// SCHED_FIFO, or with an invalid CPU, the loop still runs unpinned/SCHED_OTHER.
+struct ThreadSetup {
+    bool pinned = false;
+    bool fifo   = false;
+};
+
+struct RuntimeStats {
+    uint64_t cycles         = 0;
+    uint64_t overruns       = 0;  // Cycles that finished after the next deadline
+    uint64_t missed_periods = 0;  // Deadlines skipped to recover from overruns
+    int64_t  min_jitter_ns  = 0;  // Wakeup minus deadline
+    int64_t  max_jitter_ns  = 0;
+    int64_t  mean_jitter_ns = 0;
+    uint64_t max_busy_ns    = 0;  // Longest input + execute + output
+    diagnostics::LatencyHistogram jitter_us;  // |wakeup − deadline|
+};
+
+// Fixed-period production loop around an AdasManager.
+//
+// Every cycle sleeps with clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME)
+// until an absolute deadline (start + n·period), so the cost of a cycle
+// never shifts the ones after it. It then calls input (publish or post
+// sensor data, prepare the state), AdasManager::execute() (which drains
+// posted events), and output.
+class AdasRuntime {
+public:
+    using Input  = std::function<void(features::AdasManager&, VehicleState&, uint64_t cycle)>;
+    using Output = std::function<void(const VehicleState&, uint64_t cycle)>;
+
+    explicit AdasRuntime(features::AdasManager& manager, const RuntimeConfig& config = RuntimeConfig{});
+
+    // Apply CPU pinning and SCHED_FIFO from the config to the calling thread.
+    ThreadSetup applyThreadSettings() const;
+
+    // Run cycles on the calling thread until stop() or max_cycles (0 = no limit).
+    // The state is reset to VehicleState{} before each input call.
+    void run(const Input& input, const Output& output, uint64_t max_cycles = 0);
+
+    // Ask run() to return after the current cycle. Safe from any thread. A
+    // stop() before run() starts is kept: that run() returns at once.
+    void stop() { stop_.store(true, std::memory_order_release); }
+
+    const RuntimeStats&  stats() const { return stats_; }
+    const RuntimeConfig& config() const { return config_; }
+
+private:
+    features::AdasManager& manager_;
+    RuntimeConfig          config_;
+    RuntimeStats           stats_;
+    std::atomic<bool>      stop_{false};
+};
+
+} // namespace runtime
+} // namespace adas
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include "adas/signals/Signal.hpp"
+#include "adas/signals/SignalWatchdog.hpp"
 
 namespace adas {
 namespace signals {
@@ -19,7 +20,18 @@ public:
     // Checks are applied in order of severity: TIMEOUT > OUT_OF_RANGE > LOW_CONFIDENCE > VALID.
     void validate(Signal<float>& signal, uint64_t current_time_ms) const;
 
+    // Same checks, with freshness taken from a watchdog monitoring the
+    // signal instead of from its timestamp; a signal the watchdog has never
+    // seen stays INITIALIZING.
+    void validate(Signal<float>& signal, const SignalWatchdog& watchdog, SignalId id) const;
+
+    // Monitor the signal with this validator's timeout.
+    SignalId watch(SignalWatchdog& watchdog) const { return watchdog.add(timeout_ms_); }
+
 private:
+    // Range and confidence checks on a signal known to be fresh.
+    void validateValue(Signal<float>& signal) const;
+
     float    min_value_;       // Lower bound of the physically valid range
     float    max_value_;       // Upper bound of the physically valid range
     float    min_confidence_;  // Minimum acceptable sensor confidence [0.0 – 1.0]
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "adas/signals/SignalStatus.hpp"
+
+namespace adas {
+namespace signals {
+
+using SignalId = uint32_t;
+
+// Freshness monitor for many periodic signals.
+//
+// Every signal has a timeout. feed() on each sample pushes its deadline
+// out; advance() moves time forward and fires the expiry handler once for
+// every signal whose deadline passed. Deadlines sit in a hierarchical
+// timing wheel (4 levels of 64 slots, 1 ms ticks). feed() only stores the
+// new deadline: an entry whose deadline moved is re-filed when its old slot
+// comes up, so a signal costs at most one re-file per level per timeout,
+// however often it is fed. advance() costs O(ticks + expiries + re-files),
+// independent of how many signals are healthy.
+//
+// Not thread-safe: feed() and advance() belong to one thread.
+class SignalWatchdog {
+public:
+    using ExpiryHandler = std::function<void(SignalId id, uint64_t now_ms)>;
+
+    static constexpr std::size_t kLevels       = 4;
+    static constexpr std::size_t kSlotBits     = 6;
+    static constexpr std::size_t kSlots        = std::size_t{1} << kSlotBits;
+    static constexpr uint64_t    kMaxTimeoutMs = (uint64_t{1} << (kLevels * kSlotBits)) - 1;  // ~4.6 h
+
+    explicit SignalWatchdog(ExpiryHandler on_expiry = nullptr);
+
+    // Monitor a new signal, timeout clamped to [1, kMaxTimeoutMs]. It stays
+    // INITIALIZING, and cannot time out, until its first feed().
+    SignalId add(uint64_t timeout_ms);
+
+    // A sample of the signal taken at time_ms arrived. Returns true when
+    // this ends a TIMEOUT.
+    bool feed(SignalId id, uint64_t time_ms);
+
+    // Move time on to now_ms, firing the handler for each signal that timed
+    // out. Returns the number of expiries; earlier times are ignored.
+    std::size_t advance(uint64_t now_ms);
+
+    // INITIALIZING, VALID (fed within its timeout) or TIMEOUT.
+    SignalStatus status(SignalId id) const;
+
+    uint64_t    timeoutMs(SignalId id) const { return timeout_ms_[id]; }
+    std::size_t size() const { return timeout_ms_.size(); }
+    std::size_t armed() const { return armed_; }
+    uint64_t    now() const { return now_ms_; }
+
+private:
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    void insert(SignalId id, uint64_t earliest);  // File at max(deadline, earliest)
+    void cascade(std::size_t level, uint64_t tick);
+    std::size_t expire(uint64_t tick);
+
+    ExpiryHandler on_expiry_;
+    uint64_t      now_ms_ = 0;
+    std::size_t   armed_  = 0;
+
+    // ── Per signal ──
+    std::vector<uint64_t>     deadline_ms_;
+    std::vector<uint32_t>     timeout_ms_;
+    std::vector<uint32_t>     next_;    // Next signal in the same slot
+    std::vector<SignalStatus> status_;
+
+    std::array<uint32_t, kLevels * kSlots> slots_;  // List heads, level-major
+};
+
+} // namespace signals
+} // namespace adas
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace adas {
+namespace sim {
+
+// Order of events that fall on the same instant: scenario triggers change
+// the world first, sensors then sample it, and control runs last on the
+// freshest data.
+enum class Phase : uint8_t {
+    TRIGGER = 0,
+    SENSOR  = 1,
+    CONTROL = 2
+};
+
+// Discrete-event simulation clock.
+//
+// Holds timed actions in a priority queue and runs them in (time, phase,
+// scheduling order). The clock jumps straight from one event to the next,
+// so idle stretches cost nothing, and every periodic source runs at its own
+// rate instead of a shared tick. Times are microseconds of simulated time.
+class EventScheduler {
+public:
+    using TaskId = uint32_t;
+    using Action = std::function<void(uint64_t now_us)>;
+
+    // Run action once at time_us (clamped to now()).
+    TaskId at(uint64_t time_us, Phase phase, Action action);
+
+    // Run action at first_us and then every period_us until cancelled.
+    TaskId every(uint64_t period_us, uint64_t first_us, Phase phase, Action action);
+
+    // Drop a task's future runs. Safe to call from inside an action.
+    void cancel(TaskId id);
+
+    // Run events in order while the next one is at or before end_us and
+    // stop() has not been called, then move the clock to end_us (unless
+    // stopped). Returns the number of actions run.
+    std::size_t runUntil(uint64_t end_us);
+
+    // Run until the queue is empty or stop() is called.
+    std::size_t run();
+
+    // Make runUntil() return after the current action.
+    void stop() { stopped_ = true; }
+
+    uint64_t    now() const { return now_us_; }
+    std::size_t pending() const { return queue_.size(); }
+
+private:
+    struct Task {
+        Action   action;
+        uint64_t period_us;  // 0 = one-shot
+        Phase    phase;
+        bool     cancelled;
+    };
+
+    struct Entry {
+        uint64_t time_us;
+        Phase    phase;
+        uint64_t sequence;
+        TaskId   task;
+    };
+
+    // Earliest time, then phase, then scheduling order on top.
+    struct LaterFirst {
+        bool operator()(const Entry& a, const Entry& b) const {
+            if (a.time_us != b.time_us) return a.time_us > b.time_us;
+            if (a.phase != b.phase) return a.phase > b.phase;
+            return a.sequence > b.sequence;
+        }
+    };
+
+    void push(uint64_t time_us, TaskId id);
+    std::size_t drain(uint64_t end_us);
+
+    std::deque<Task> tasks_;  // Stable references while actions add tasks
+    std::priority_queue<Entry, std::vector<Entry>, LaterFirst> queue_;
+    uint64_t now_us_        = 0;
+    uint64_t next_sequence_ = 0;
+    bool     stopped_       = false;
+};
+
+} // namespace sim
+} // namespace adas
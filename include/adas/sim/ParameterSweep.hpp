@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "adas/features/Calibration.hpp"
+#include "adas/sim/Scenario.hpp"
+
+namespace adas {
+namespace sim {
+
+// A value that a sweep axis can vary: a feature calibration or a scenario input.
+enum class SweepParam {
+    AEB_FULL_BRAKE_TTC,     // AebCalibration::full_brake_ttc_s
+    AEB_PARTIAL_BRAKE_TTC,  // AebCalibration::partial_brake_ttc_s
+    ACC_MIN_GAP,            // AccCalibration::min_gap_m
+    ACC_SPEED_GAIN,         // AccCalibration::speed_gain
+    ACC_GAP_GAIN,           // AccCalibration::gap_gain
+    EGO_SPEED,              // TargetBrakingScenario::ego_speed_mps (target starts equal)
+    TARGET_DECEL,           // TargetBrakingScenario::target_decel_mps2
+    INITIAL_DISTANCE        // TargetBrakingScenario::initial_distance_m
+};
+
+// Lower-case identifier used on the command line and in sweep.json.
+const char* toString(SweepParam param);
+
+// Parses an identifier produced by toString(). Returns false if unknown.
+bool parseSweepParam(const std::string& text, SweepParam& param);
+
+// steps evenly spaced values from min to max inclusive (min only if steps == 1).
+struct SweepAxis {
+    SweepParam param;
+    float      min   = 0.0f;
+    float      max   = 0.0f;
+    uint32_t   steps = 1;
+
+    float valueAt(uint32_t i) const;
+};
+
+// A scenario template, a base calibration, and the axes to vary around them.
+struct SweepConfig {
+    TargetBrakingScenario     scenario;
+    features::AdasCalibration calibration;
+    std::vector<SweepAxis>    axes;
+};
+
+// Dense per-point results, row-major with the last axis varying fastest.
+struct SweepMaps {
+    std::vector<uint8_t> activation;  // ScenarioOutcome::aeb_level
+    std::vector<float>   min_gap_m;   // ScenarioOutcome::min_gap_m
+    std::vector<uint8_t> collision;   // 1 if the run ended in a collision
+
+    void resize(std::size_t n);
+};
+
+// Evaluates a scenario over the full Cartesian grid of its axes, spreading
+// grid points across worker threads.
+class ParameterSweep {
+public:
+    explicit ParameterSweep(SweepConfig config);
+
+    // Number of grid points (product of axis steps).
+    std::size_t size() const { return size_; }
+
+    const SweepConfig& config() const { return config_; }
+
+    // Calibration and scenario for one grid point.
+    void pointAt(std::size_t index,
+                 features::AdasCalibration& calibration,
+                 TargetBrakingScenario& scenario) const;
+
+    // Evaluate grid points [begin, end) into out[0 .. end-begin).
+    // threads == 0 uses every hardware thread.
+    void runRange(std::size_t begin, std::size_t end, SweepMaps& out,
+                  unsigned threads = 0) const;
+
+    // Evaluate the whole grid.
+    SweepMaps run(unsigned threads = 0) const;
+
+    // Write maps as raw host-order arrays (activation.u8, min_gap.f32,
+    // collision.u8) plus a sweep.json descriptor into dir, creating it if
+    // needed. Returns false on I/O failure.
+    bool writeMaps(const SweepMaps& maps, const std::string& dir) const;
+
+private:
+    SweepConfig config_;
+    std::size_t size_ = 1;
+};
+
+} // namespace sim
+} // namespace adas
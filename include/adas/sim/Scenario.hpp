@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include "adas/features/Calibration.hpp"
+
+namespace adas {
+namespace sim {
+
+// The live_sim emergency-brake case as a parameterised template: ego and
+// target start at the same speed, then the target brakes hard.
+struct TargetBrakingScenario {
+    float    ego_speed_mps        = 30.0f;  // Initial ego speed (m/s)
+    float    target_speed_mps     = 30.0f;  // Initial target speed (m/s)
+    float    initial_distance_m   = 80.0f;  // Initial gap (m)
+    float    target_decel_mps2    = 8.0f;   // Target deceleration once braking (m/s²)
+    uint64_t brake_start_ms       = 2000;   // When the target starts braking
+    uint64_t duration_ms          = 10000;  // Simulated time
+    uint64_t step_ms              = 100;    // Control cycle
+    float    aeb_max_decel_mps2   = 9.0f;   // Ego deceleration at brake_intensity 1.0 (m/s²)
+    float    collision_distance_m = 2.0f;   // Radar gap treated as contact (m)
+};
+
+// What happened during one scenario run.
+struct ScenarioOutcome {
+    uint8_t aeb_level  = 0;       // Strongest AEB response: 0 none, 1 partial, 2 full
+    bool    collision  = false;   // Gap fell to collision_distance_m
+    float   min_gap_m  = 0.0f;    // Smallest gap seen
+};
+
+// Run the scenario headless (no printing, no pacing) against a fresh
+// AdasManager built with the given calibration.
+ScenarioOutcome runTargetBraking(const TargetBrakingScenario& scenario,
+                                 const features::AdasCalibration& calibration);
+
+} // namespace sim
+} // namespace adas
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "adas/events/EventData.hpp"
+#include "adas/features/AdasManager.hpp"
+#include "adas/sim/World.hpp"
+#include "adas/VehicleState.hpp"
+
+namespace adas {
+namespace sim {
+
+// Radar: reports the nearest actor in the ego's lane, ahead (FRONT) or
+// behind (REAR, e.g. for Door Open Warning).
+class RadarSensor {
+public:
+    enum class Facing { FRONT, REAR };
+
+    explicit RadarSensor(float range_m = 200.0f, float confidence = 0.95f,
+                         Facing facing = Facing::FRONT)
+        : range_m_(range_m), confidence_(confidence), facing_(facing) {}
+
+    // With nothing in range, reports the "no target" value used across the
+    // simulators: distance 999 m, speed 0. Searches World::byPosition(), so
+    // a call costs O(log N) plus the actors passed in other lanes, and
+    // sensing for every ego stays well under O(N²).
+    events::RadarData sense(const World& world, ActorId ego) const;
+
+private:
+    float  range_m_;
+    float  confidence_;
+    Facing facing_;
+};
+
+// Lane camera: reports the ego's offset from the centre of its current lane.
+class LaneSensor {
+public:
+    explicit LaneSensor(float confidence = 0.9f) : confidence_(confidence) {}
+
+    events::LaneData sense(const World& world, ActorId ego) const;
+
+private:
+    float confidence_;
+};
+
+// Connects one ego actor in a World to an AdasManager: publishes synthesised
+// sensor events, and turns the manager's VehicleState back into commands.
+class EgoAdapter {
+public:
+    // aeb_max_decel_mps2: ego deceleration at brake_intensity 1.0
+    explicit EgoAdapter(ActorId ego, float aeb_max_decel_mps2 = 9.0f)
+        : ego_(ego), aeb_max_decel_mps2_(aeb_max_decel_mps2) {}
+
+    // Publish SPEED_UPDATE, RADAR_UPDATE and LANE_UPDATE for this ego.
+    void publishSensors(const World& world, features::AdasManager& mgr) const;
+
+    // Apply commanded acceleration, AEB braking and steering to the ego.
+    void applyOutputs(World& world, const VehicleState& state) const;
+
+    ActorId ego() const { return ego_; }
+
+    RadarSensor radar;
+    LaneSensor  lane;
+    bool        apply_steering = true;  // false keeps lateral motion scripted
+
+private:
+    ActorId ego_;
+    float   aeb_max_decel_mps2_;
+};
+
+} // namespace sim
+} // namespace adas
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include "adas/sim/ParameterSweep.hpp"
+
+namespace adas {
+namespace sim {
+
+// Splits a ParameterSweep into fixed-size shards coordinated through a
+// campaign directory, so a sweep can span processes and hosts and survive
+// crashes:
+//
+//   DIR/campaign.bin           encoded sweep config + shard size; a resumed
+//                              or remote worker must match it exactly
+//   DIR/shards/NNNNNN.claim    created with O_EXCL by the worker that owns
+//                              the shard; holds "host pid"
+//   DIR/shards/NNNNNN.result   finished shard, written to a temporary file
+//                              and renamed into place
+//
+// Any number of workers on hosts sharing DIR may call work() concurrently.
+// Result files are host byte order: workers must share endianness.
+class ShardedSweep {
+public:
+    ShardedSweep(const ParameterSweep& sweep, std::string campaign_dir,
+                 std::size_t shard_points = 4096);
+
+    // Create the campaign directory, or check that an existing one was
+    // started with the same config. Returns false on mismatch or I/O error.
+    bool prepare();
+
+    std::size_t shardCount() const { return shard_count_; }
+
+    // Grid points [first, second) covered by a shard.
+    std::pair<std::size_t, std::size_t> shardRange(std::size_t shard) const;
+
+    // Remove claims left by dead processes on this host, so their shards
+    // are picked up again. Returns the number removed.
+    std::size_t recoverStaleClaims() const;
+
+    // Claim and evaluate shards until none are unclaimed. Returns the number
+    // of shards this call completed. A shard it claimed but could not finish
+    // is released for another worker and counted in *failed.
+    std::size_t work(unsigned threads = 1, std::size_t* failed = nullptr) const;
+
+    // Fork `processes` workers that each call work(1), and wait for them.
+    // Returns true if every worker exited cleanly and finished every shard
+    // it claimed.
+    bool runLocal(unsigned processes) const;
+
+    // Shards with a result file on disk.
+    std::size_t completedShards() const;
+
+    // Assemble every shard result into dense maps. Returns false if a shard
+    // is missing or its file is malformed.
+    bool merge(SweepMaps& out) const;
+
+private:
+    std::string shardPath(std::size_t shard, const char* suffix) const;
+    bool        runShard(std::size_t shard, unsigned threads) const;
+    bool        readShard(std::size_t shard, SweepMaps& out) const;
+
+    const ParameterSweep& sweep_;
+    std::string           dir_;
+    std::size_t           shard_points_;
+    std::size_t           shard_count_;
+};
+
+} // namespace sim
+} // namespace adas
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace adas {
+namespace sim {
+
+// Index of an actor in a World. Stable for the World's lifetime.
+using ActorId = uint32_t;
+
+// Multi-actor road world for simulation.
+//
+// Actors are point vehicles on a straight multi-lane road, stored as
+// structure-of-arrays so one integration step is a handful of tight loops
+// over contiguous floats. Coordinates:
+//   s  — longitudinal position along the road (m)
+//   d  — lateral offset from the centre of lane 0 (m); +right, -left
+//   heading — angle to the road direction (rad), small-angle model
+//
+// Dynamics per fixed step dt (semi-implicit Euler, kinematic bicycle with
+// small-angle approximation):
+//   v       = max(0, v + a·dt)
+//   s      += v·dt
+//   heading += v·steer / wheelbase · dt
+//   d      += v·heading · dt
+//
+// Not thread-safe, const members included: byPosition() fills a cache.
+class World {
+public:
+    explicit World(float step_s = 0.01f, float lane_width_m = 3.5f, float wheelbase_m = 2.8f);
+
+    // Add an actor driving straight at constant speed. Returns its id.
+    ActorId addActor(float s_m, float d_m, float speed_mps);
+
+    void reserve(std::size_t actors);
+    std::size_t actorCount() const { return s_.size(); }
+
+    // Commands held until changed.
+    void setAcceleration(ActorId id, float accel_mps2) { accel_[id] = accel_mps2; }
+    void setSteering(ActorId id, float steering_rad) { steer_[id] = steering_rad; }
+
+    // Script overrides, e.g. a lane drift or stopping actors on contact.
+    void setLateralOffset(ActorId id, float d_m) { d_[id] = d_m; }
+    void setSpeed(ActorId id, float speed_mps) { v_[id] = speed_mps; }
+
+    // Integrate every actor by one fixed step.
+    void step();
+
+    // Integrate by duration_s using as many fixed steps as fit. The remainder
+    // is carried into the next call, so repeated calls never drift.
+    void advance(float duration_s);
+
+    // Step until time() is within half a step of time_s; never steps back.
+    // For event-driven callers that know absolute times. Do not mix with advance().
+    void advanceTo(double time_s);
+
+    float  stepSize() const { return step_s_; }
+    double time() const { return time_s_; }
+    float  laneWidth() const { return lane_width_m_; }
+
+    // Centre of the lane that lateral offset d_m falls in.
+    float laneCentre(float d_m) const;
+
+    float position(ActorId id) const { return s_[id]; }
+    float lateralOffset(ActorId id) const { return d_[id]; }
+    float speed(ActorId id) const { return v_[id]; }
+    float heading(ActorId id) const { return heading_[id]; }
+
+    // Whole-array views for sensors and analytics.
+    const std::vector<float>& positions() const { return s_; }
+    const std::vector<float>& lateralOffsets() const { return d_; }
+    const std::vector<float>& speeds() const { return v_; }
+
+    // Actor ids in ascending position (ties by id), for sensors that look
+    // for the nearest actor. Re-sorted on first use after a step: an
+    // insertion sort, near O(N) while overtakes are rare.
+    const std::vector<ActorId>& byPosition() const;
+
+private:
+    float  step_s_;
+    float  lane_width_m_;
+    float  wheelbase_m_;
+    double time_s_     = 0.0;
+    float  remainder_s_ = 0.0f;
+
+    std::vector<float> s_;
+    std::vector<float> d_;
+    std::vector<float> v_;
+    std::vector<float> heading_;
+    std::vector<float> accel_;
+    std::vector<float> steer_;
+
+    mutable std::vector<ActorId> order_;  // Cache for byPosition()
+    mutable bool                 order_stale_ = false;
+};
+
+} // namespace sim
+} // namespace adas
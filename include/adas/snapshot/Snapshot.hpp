@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace adas {
+namespace snapshot {
+
+// Appends plain values to a compact binary image.
+// Values are stored in host byte order: snapshots are meant to be restored
+// by the same build on the same machine, not exchanged between platforms.
+class SnapshotWriter {
+public:
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "write() needs a POD value");
+        const auto* p = reinterpret_cast<const uint8_t*>(&value);
+        bytes_.insert(bytes_.end(), p, p + sizeof(T));
+    }
+
+    // One byte, 0 or 1.
+    void write(bool value) { write(static_cast<uint8_t>(value ? 1 : 0)); }
+
+    // Length-prefixed string (u32 length + bytes).
+    void writeString(const std::string& s);
+
+    // Length-prefixed nested block, e.g. one feature's state.
+    void writeBlock(const std::vector<uint8_t>& block);
+
+    const std::vector<uint8_t>& bytes() const { return bytes_; }
+    std::vector<uint8_t> release() { return std::move(bytes_); }
+
+private:
+    std::vector<uint8_t> bytes_;
+};
+
+// Reads values back in the order they were written.
+// Every read is bounds-checked; once a read fails, ok() stays false and all
+// further reads fail, so callers can check once at the end.
+class SnapshotReader {
+public:
+    SnapshotReader(const uint8_t* data, std::size_t size) : data_(data), size_(size) {}
+    explicit SnapshotReader(const std::vector<uint8_t>& bytes)
+        : SnapshotReader(bytes.data(), bytes.size()) {}
+
+    template <typename T>
+    bool read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "read() needs a POD value");
+        if (!ok_ || size_ - pos_ < sizeof(T)) return ok_ = false;
+        std::memcpy(&value, data_ + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    // A byte other than 0 or 1 is malformed.
+    bool read(bool& value);
+
+    bool readString(std::string& s);
+
+    // Returns a reader over the next length-prefixed block.
+    SnapshotReader readBlock();
+
+    bool ok() const { return ok_; }
+    bool atEnd() const { return pos_ == size_; }
+    std::size_t remaining() const { return size_ - pos_; }
+
+private:
+    const uint8_t* data_;
+    std::size_t    size_;
+    std::size_t    pos_ = 0;
+    bool           ok_  = true;
+};
+
+} // namespace snapshot
+} // namespace adas
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Scoped trace probes.
+//
+// ADAS_TRACE_SCOPE("name") records a span from the macro to the end of the
+// enclosing scope. Probes compile to nothing unless the build defines
+// ADAS_ENABLE_TRACE (CMake option of the same name). When compiled in, they
+// record only between trace::start() and trace::stop().
+//
+// Names and categories must be string literals or otherwise outlive the
+// trace: only the pointers are stored.
+
+namespace adas {
+namespace trace {
+
+// One completed span.
+struct Span {
+    const char* name;
+    const char* category;
+    uint64_t    start_ns;
+    uint64_t    duration_ns;
+};
+
+// Nanoseconds on std::chrono::steady_clock.
+uint64_t nowNs();
+
+// Begin/end recording. Probes hit while stopped cost one relaxed load.
+void start();
+void stop();
+bool active();
+
+// Append a span to the calling thread's buffer. Each thread owns its
+// buffer, so recording takes no lock. Buffers grow on demand up to 65536
+// spans; a full buffer drops the span.
+void record(const char* name, const char* category, uint64_t start_ns, uint64_t end_ns);
+
+// Spans recorded so far across all threads, and spans dropped on full buffers.
+std::size_t spanCount();
+std::size_t droppedCount();
+
+// Memory held by span buffers across all threads.
+std::size_t bufferBytes();
+
+// Write every recorded span as Chrome trace-event JSON (opens in Perfetto
+// and chrome://tracing). Call while no probes are running. Returns false if
+// the file cannot be written.
+bool writeChromeJson(const std::string& path);
+
+// Discard all recorded spans and free their buffers, including those of
+// exited threads. Call while no probes are running.
+void reset();
+
+// RAII span; what the macros expand to.
+class Scope {
+public:
+    Scope(const char* name, const char* category)
+        : name_(name), category_(category), start_ns_(active() ? nowNs() : 0) {}
+    ~Scope() {
+        if (start_ns_ != 0) record(name_, category_, start_ns_, nowNs());
+    }
+
+    Scope(const Scope&)            = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    const char* name_;
+    const char* category_;
+    uint64_t    start_ns_;
+};
+
+} // namespace trace
+} // namespace adas
+
+#define ADAS_TRACE_CONCAT_INNER(a, b) a##b
+#define ADAS_TRACE_CONCAT(a, b)       ADAS_TRACE_CONCAT_INNER(a, b)
+
+#if defined(ADAS_ENABLE_TRACE) && ADAS_ENABLE_TRACE
+#define ADAS_TRACE_SCOPE_CAT(category, name) \
+    ::adas::trace::Scope ADAS_TRACE_CONCAT(adas_trace_scope_, __LINE__)(name, category)
+#else
+#define ADAS_TRACE_SCOPE_CAT(category, name) ((void)0)
+#endif
+
+#define ADAS_TRACE_SCOPE(name) ADAS_TRACE_SCOPE_CAT("adas", name)
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+#include "adas/events/EventData.hpp"
+#include "adas/events/EventType.hpp"
+#include "adas/events/IEventSubscriber.hpp"
+#include "adas/snapshot/Snapshot.hpp"
+
+namespace adas {
+namespace tracking {
+
+struct TrackerConfig {
+    float    cell_m            = 4.0f;   // Association grid cell; must be >= gate_m
+    float    gate_m            = 3.0f;   // Largest detection-to-track distance (m)
+    float    accel_noise       = 2.0f;   // Process noise: acceleration std dev (m/s²)
+    float    measurement_noise = 0.5f;   // Detection position std dev (m)
+    uint16_t confirm_hits      = 3;      // Hits before a track is published
+    uint16_t max_misses        = 3;      // Consecutive misses before a track is dropped
+    float    lane_half_width_m = 1.75f;  // Lead target must be this close to the ego's line
+    float    coast_confidence  = 0.5f;   // Share of a track's confidence kept per missed scan
+    float    radar_range_m     = 200.0f; // A radar "nothing in range" clears the path this far
+};
+
+// Multi-object tracker between the sensors and the braking path.
+//
+// Each OBJECT_LIST_UPDATE scan, and each RADAR_UPDATE as a scan of at most
+// one in-path detection, is folded into a fixed table of tracks
+// (structure-of-arrays, constant-velocity Kalman filter per axis). Detections
+// are associated through a uniform grid hashed by cell, so a scan costs
+// O(detections + tracks) rather than all pairs. After each scan the tracker
+// emits TRACK_UPDATE with the confirmed tracks and LEAD_UPDATE (a RadarData)
+// for the nearest confirmed track in the ego's path, so AEB and ACC act on a
+// target that survives single noisy or missing detections.
+//
+// Without a confirmed lead, LEAD_UPDATE reports no target at the confidence
+// of the radar's last "nothing in range" report, or at confidence 0 when the
+// radar has not reported a clear path since its last target. A clear-path
+// report drops the in-path tracks within radar range at once, and a track
+// that coasts through missed scans loses confidence with each one.
+class Tracker : public events::IEventSubscriber {
+public:
+    using Sink = std::function<void(events::EventType, events::EventData)>;
+
+    explicit Tracker(Sink sink, const TrackerConfig& config = TrackerConfig{});
+
+    // OBJECT_LIST_UPDATE and RADAR_UPDATE run a scan; SPEED_UPDATE gives the
+    // ego speed between relative track speeds and absolute target speeds.
+    void onEvent(events::EventType type, const events::EventData& data) override;
+
+    // Fold one camera scan taken at time_us into the track table and emit results.
+    void update(const events::DetectionList& scan, uint64_t time_us);
+
+    // Same for one radar report. The radar sees only the nearest target in
+    // the ego's path, so only in-path tracks nearer than it count a miss;
+    // with nothing in range, those within radar_range_m are dropped.
+    void updateRadar(const events::RadarData& radar, uint64_t time_us);
+
+    // Append the track table, ego speed and radar clear-path state to a
+    // checkpoint image.
+    void saveState(snapshot::SnapshotWriter& out) const;
+
+    // Replace that state with one written by saveState(). Returns false on
+    // malformed input, in which case the tracker is left unchanged.
+    bool restoreState(snapshot::SnapshotReader& in);
+
+    std::size_t trackCount() const { return count_; }
+    uint64_t    droppedTrackLists() const { return dropped_lists_; }  // Track pool exhausted
+
+private:
+    static constexpr std::size_t kCapacity    = events::TrackList::kMaxTracks;
+    static constexpr std::size_t kGridBuckets = 1024;  // Power of two
+
+    // Tracks a scan could have seen; unmatched tracks outside it keep their misses.
+    struct FieldOfView {
+        bool  path_only = false;  // Only tracks in the ego's lane ahead
+        float range_m   = std::numeric_limits<float>::infinity();
+        bool  clear     = false;  // Nothing in view: unmatched tracks in it are dropped
+    };
+
+    void step(const events::DetectionList& scan, uint64_t time_us, const FieldOfView& view);
+    void predict(float dt_s);
+    void associate(const events::DetectionList& scan, const FieldOfView& view);
+    void correct(std::size_t track, const events::Detection& d);
+    bool inPath(std::size_t track) const;
+    void spawn(const events::Detection& d);
+    void prune();
+    void publish(uint64_t time_us);
+
+    std::size_t bucketOf(float x, float y, int dx = 0, int dy = 0) const;
+
+    Sink          sink_;
+    TrackerConfig cfg_;
+    events::PayloadPool<events::TrackList> pool_{4};
+
+    // ── Track table ──
+    std::size_t                     count_ = 0;
+    std::array<uint32_t, kCapacity> id_{};
+    std::array<float, kCapacity>    x_{}, vx_{}, y_{}, vy_{};
+    std::array<float, kCapacity>    pxx_{}, pxv_{}, pvv_{};  // Covariance, shared by both axes
+    std::array<float, kCapacity>    confidence_{};           // Of the last associated detection
+    std::array<uint16_t, kCapacity> hits_{}, misses_{};
+    std::array<uint8_t, kCapacity>  matched_{};
+
+    // ── Association scratch, reused every scan ──
+    std::array<uint32_t, kGridBuckets + 1> bucket_start_{};
+    std::array<uint16_t, kCapacity>        by_bucket_{};
+    struct Candidate {
+        float    distance2;
+        uint16_t detection;
+        uint16_t track;
+    };
+    std::vector<Candidate> candidates_;
+    std::vector<uint8_t>   detection_used_;
+
+    uint32_t next_id_          = 1;
+    uint64_t last_time_us_     = 0;
+    bool     has_time_         = false;
+    float    ego_speed_mps_    = 0.0f;
+    float    clear_confidence_ = 0.0f;  // Of the radar's last "nothing in range", 0 after a target
+    uint64_t dropped_lists_    = 0;
+};
+
+} // namespace tracking
+} // namespace adas
@@ -0,0 +1,91 @@
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "adas/can/ActuatorEncoder.hpp"
+#include "adas/can/CanDecoder.hpp"
+#include "adas/features/AdasManager.hpp"
+#include "adas/VehicleState.hpp"
+
+using namespace adas;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// CAN replay — feeds a candump log through the CAN decoder into AdasManager,
+// running a control cycle every --cycle-ms of log time.
+//
+//   adas_can_replay LOG [--cycle-ms N]
+//
+// Reports decoded/unknown frames, the DTCs raised, the actuator frames the
+// output stage sent, and raw decode throughput.
+// ─────────────────────────────────────────────────────────────────────────────
+
+int main(int argc, char* argv[]) {
+    std::string path;
+    uint64_t    cycle_ms = 10;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--cycle-ms" && i + 1 < argc) {
+            cycle_ms = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            path = arg;
+        }
+    }
+    if (path.empty() || cycle_ms == 0) {
+        std::cout << "usage: adas_can_replay LOG [--cycle-ms N]\n";
+        return 1;
+    }
+
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "cannot open " << path << "\n";
+        return 1;
+    }
+    std::vector<can::CanFrame> frames;
+    can::CandumpReader reader(in);
+    for (can::CanFrame f; reader.next(f);) frames.push_back(f);
+    std::cout << frames.size() << " frames read, " << reader.skippedLines() << " lines skipped\n";
+    if (frames.empty()) return 0;
+
+    // Replay: cycle boundaries follow the log's own timestamps.
+    const can::CanDecoder decoder;
+    features::AdasManager mgr;
+    const uint64_t start_us      = frames.front().time_us;
+    uint64_t       now_us        = start_us;
+    uint64_t       next_cycle_us = start_us + cycle_ms * 1000;
+    std::size_t    decoded = 0, cycles = 0, brake_cycles = 0;
+    can::ActuatorEncoder output([](const can::CanFrame&) {});
+    mgr.setClock([&now_us] { return now_us; });  // Log time
+    for (const can::CanFrame& f : frames) {
+        for (; f.time_us >= next_cycle_us; next_cycle_us += cycle_ms * 1000) {
+            now_us = next_cycle_us;
+            VehicleState state;
+            mgr.execute(state, (next_cycle_us - start_us) / 1000);
+            ++cycles;
+            brake_cycles += state.brake_requested ? 1 : 0;
+            output.update(state, next_cycle_us);
+        }
+        now_us = f.time_us;
+        decoded += decoder.feed(f, mgr) ? 1 : 0;
+    }
+    std::cout << decoded << " decoded, " << frames.size() - decoded << " unknown, "
+              << cycles << " control cycles (" << brake_cycles << " braking), "
+              << mgr.dtcManager().entries().size() << " DTCs\n";
+    std::cout << "Actuator output: " << output.framesSent() << " frames sent, "
+              << output.framesSuppressed() << " unchanged and suppressed\n";
+
+    // Decode-only throughput, to compare against bus load (a saturated 5 Mbit/s
+    // CAN-FD bus carries roughly 10k-40k frames/s depending on payload size).
+    constexpr int kPasses = 50;
+    events::EventType type;
+    events::EventData data;
+    std::size_t sink = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < kPasses; ++pass) {
+        for (const can::CanFrame& f : frames) sink += decoder.decode(f, type, data) ? 1 : 0;
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "Decode: " << static_cast<double>(sink) / seconds / 1e6 << " M frames/s\n";
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "adas/diagnostics/DiagServer.hpp"
+
+using namespace adas;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Diagnostic client — polls a running adas_runtime --diag-socket PATH and
+// prints the latest cycle: outputs, feature timings and the newest DTC.
+//
+//   adas_diag PATH [--hz N] [--count N]
+//
+// --count 0 polls until the server goes away.
+// ─────────────────────────────────────────────────────────────────────────────
+
+int main(int argc, char* argv[]) {
+    std::string path;
+    double      hz    = 10.0;
+    uint64_t    count = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--hz" && i + 1 < argc) {
+            hz = std::strtod(argv[++i], nullptr);
+        } else if (arg == "--count" && i + 1 < argc) {
+            count = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            path = arg;
+        }
+    }
+    if (path.empty() || hz <= 0.0) {
+        std::cout << "usage: adas_diag PATH [--hz N] [--count N]\n";
+        return 1;
+    }
+
+    diagnostics::DiagClient client;
+    if (!client.connect(path)) {
+        std::cerr << "cannot connect to " << path << "\n";
+        return 1;
+    }
+    const auto period = std::chrono::duration<double>(1.0 / hz);
+    auto       next   = std::chrono::steady_clock::now();
+    diagnostics::DiagFrame frame;
+    uint64_t               version = 0;
+    for (uint64_t n = 0; count == 0 || n < count; ++n) {
+        if (!client.poll(frame, &version)) {
+            std::cerr << "server closed the connection\n";
+            return n == 0 ? 1 : 0;
+        }
+        const VehicleState& s = frame.state;
+        std::cout << std::fixed << std::setprecision(2)
+                  << "cycle " << frame.cycle << "  t " << frame.time_ms << "ms"
+                  << "  exec " << frame.cycle_ns / 1000.0 << "us (";
+        for (uint32_t f = 0; f < frame.feature_count; ++f) {
+            std::cout << (f ? " " : "") << frame.feature_ns[f] / 1000.0;
+        }
+        std::cout << ")  shed " << frame.shed_level
+                  << "  speed " << s.ego_speed_mps << "  accel " << s.ego_acceleration
+                  << "  brake " << (s.brake_requested ? s.brake_intensity : 0.0f)
+                  << "  steer " << s.steering_angle_rad << "  DTCs " << frame.dtc_count;
+        if (frame.recent_count > 0) {
+            const diagnostics::DtcSummary& d = frame.recent[frame.recent_count - 1];
+            std::cout << " (last 0x" << std::hex << d.code << std::dec << " @" << d.timestamp_ms << "ms)";
+        }
+        std::cout << "\n";
+        next += std::chrono::duration_cast<std::chrono::steady_clock::duration>(period);
+        std::this_thread::sleep_until(next);
+    }
+    return 0;
+}
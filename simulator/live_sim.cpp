@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
 #include <iostream>
 #include <iomanip>
 #include <string>
@@ -5,18 +8,36 @@
 #include <thread>
 #include <chrono>
 #include "adas/features/AdasManager.hpp"
+#include "adas/sim/EventScheduler.hpp"
+#include "adas/sim/Sensors.hpp"
+#include "adas/sim/World.hpp"
+#include "adas/trace/Trace.hpp"
 #include "adas/VehicleState.hpp"
 
 using namespace adas;
 using namespace adas::features;
 using namespace adas::events;
+using namespace adas::sim;
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Live simulation — runs physics-based scenarios in real time.
-// Each step is 100ms of simulated time, printed with a 100ms real delay
-// so you can watch the ADAS system react as conditions change.
+// A discrete-event scheduler drives sensors, control and scenario triggers,
+// each at its own rate; the clock jumps from one event to the next and is
+// paced against wall time so you can watch the ADAS system react.
+// Vehicle motion and sensor readings come from sim::World.
 // ─────────────────────────────────────────────────────────────────────────────
 
+static void usage() {
+    std::cout << "usage: adas_live_sim [aeb|dow|all] [--fast] [--shadow-full-ttc SECONDS] [--trace FILE]\n";
+}
+
+static bool parseSeconds(const char* text, float& value) {
+    char* end = nullptr;
+    errno     = 0;
+    value     = std::strtof(text, &end);
+    return end != text && errno == 0 && *end == '\0' && std::isfinite(value) && value > 0.0f;
+}
+
 static void printHeader() {
     std::cout << std::left
               << std::setw(6)  << "T(ms)"
@@ -53,114 +74,231 @@ static void printStep(uint64_t t_ms, const VehicleState& s,
               << event_label << "\n";
 }
 
+// Every sensor is scheduled within its watchdog timeout, so any loss
+// reported here is a scenario bug.
+static void printSignalTimeouts(const AdasManager& mgr) {
+    diagnostics::DTCQuery q;
+    q.code = diagnostics::DTC::SIGNAL_TIMEOUT;
+    const auto timeouts = mgr.dtcManager().query(q);
+    std::cout << "Input timeouts: " << timeouts.size() << "\n";
+    for (const diagnostics::DTCEntry* e : timeouts) {
+        std::cout << "  [t=" << e->timestamp_ms << "ms] " << e->message << "\n";
+    }
+}
+
+// Real-time pacing: sleep until wall time catches up with simulated time.
+// Disabled by --fast.
+static bool g_realtime = true;
+
+// Candidate AEB full-brake TTC run in shadow mode during the emergency-brake
+// scenario (--shadow-full-ttc); 0 disables the shadow.
+static float g_shadow_full_ttc = 0.0f;
+
+static void paceTo(std::chrono::steady_clock::time_point wall_start, uint64_t sim_us) {
+    if (g_realtime) std::this_thread::sleep_until(wall_start + std::chrono::microseconds(sim_us));
+}
+
 // ── Scenario A: Emergency Brake ───────────────────────────────────────────────
 // Ego drives at 30 m/s. Target suddenly brakes at T=2s.
 // Watch AEB fire as TTC drops below threshold.
+// Sensors run at their own rates (speed 50 Hz, radar 20 Hz, camera 15 Hz);
+// control runs at 10 Hz on whatever each sensor last delivered.
 static void scenarioEmergencyBrake() {
     std::cout << "\n=== LIVE: Emergency Brake Scenario (10 seconds) ===\n";
     std::cout << "Ego cruises at 30 m/s. Target brakes hard at T=2s.\n\n";
     printHeader();
 
+    EventScheduler sched;
     AdasManager mgr;
+    mgr.setClock([&sched] { return sched.now(); });  // stamps and latencies in sim time
+    if (g_shadow_full_ttc > 0.0f) {
+        AdasCalibration candidate;
+        candidate.aeb.full_brake_ttc_s = g_shadow_full_ttc;
+        mgr.enableShadow(makeFeatureSet(candidate));
+    }
     VehicleState state;
 
-    const float dt        = 0.1f;   // 100ms steps
-    float ego_speed       = 30.0f;  // m/s
-    float target_speed    = 30.0f;  // m/s — same speed initially
-    float distance        = 80.0f;  // m
-    float lateral_dev     = 0.0f;
-
-    for (int step = 0; step <= 100; ++step) {
-        uint64_t t_ms = step * 100;
+    World world(0.01f);                                         // 10ms physics steps
+    const ActorId ego    = world.addActor(0.0f,  0.0f, 30.0f);  // m/s
+    const ActorId target = world.addActor(80.0f, 0.0f, 30.0f);  // same speed initially
+    EgoAdapter adapter(ego);
+    // LKA is a proportional controller with no damping; closing the lateral
+    // loop would oscillate, so the drift below stays scripted.
+    adapter.apply_steering = false;
+    bool collided       = false;
+    bool target_stopped = false;
+
+    const auto wall_start = std::chrono::steady_clock::now();
+    // Every event first brings the world up to its timestamp.
+    auto sync = [&](uint64_t now_us) {
+        paceTo(wall_start, now_us);
+        world.advanceTo(now_us * 1e-6);
+    };
+
+    // Scenario triggers
+    sched.at(2'000'000, Phase::TRIGGER, [&](uint64_t now_us) {
+        sync(now_us);
+        world.setAcceleration(target, -8.0f);  // target brakes hard, -8 m/s²
+    });
+    sched.at(5'000'000, Phase::TRIGGER, [&](uint64_t now_us) {
+        sync(now_us);
+        world.setLateralOffset(ego, 0.4f);     // lane drift (small deviation, shows LKA)
+    });
+    sched.at(8'000'000, Phase::TRIGGER, [&](uint64_t now_us) {
+        sync(now_us);
+        world.setLateralOffset(ego, 0.0f);
+    });
+
+    // Sensors
+    sched.every(20'000, 0, Phase::SENSOR, [&](uint64_t now_us) {
+        sync(now_us);
+        mgr.publish(EventType::SPEED_UPDATE, SpeedData{world.speed(ego)});
+    });
+    sched.every(50'000, 0, Phase::SENSOR, [&](uint64_t now_us) {
+        sync(now_us);
+        mgr.publish(EventType::RADAR_UPDATE, adapter.radar.sense(world, ego));
+    });
+    sched.every(66'667, 0, Phase::SENSOR, [&](uint64_t now_us) {
+        sync(now_us);
+        mgr.publish(EventType::LANE_UPDATE, adapter.lane.sense(world, ego));
+    });
+
+    // Control
+    sched.every(100'000, 0, Phase::CONTROL, [&](uint64_t now_us) {
+        sync(now_us);
+        const uint64_t t_ms = now_us / 1000;
         std::string event;
-
-        // Target brakes hard at T=2s
-        if (t_ms >= 2000 && target_speed > 0.0f) {
-            target_speed = std::max(0.0f, target_speed - 8.0f * dt);  // -8 m/s²
-            if (target_speed == 0.0f && event.empty()) event = "<< TARGET STOPPED";
+        if (t_ms >= 5000 && t_ms < 8000) event = "<< LANE DRIFT";
+        if (!target_stopped && world.speed(target) == 0.0f) {
+            target_stopped = true;
+            event = "<< TARGET STOPPED";
         }
 
-        // Lane drift starts at T=5s (small deviation, shows LKA)
-        if (t_ms >= 5000 && t_ms < 8000) {
-            lateral_dev = 0.4f;
-            event = (event.empty()) ? "<< LANE DRIFT" : event;
-        } else if (t_ms >= 8000) {
-            lateral_dev = 0.0f;
+        // Physical minimum (collision): both vehicles stop where they meet
+        float distance = world.position(target) - world.position(ego);
+        if (distance <= 2.0f && !collided) {
+            collided = true;
+            for (ActorId id : {ego, target}) {
+                world.setSpeed(id, 0.0f);
+                world.setAcceleration(id, 0.0f);
+            }
+            event = "<< COLLISION";
         }
-
-        // Update distance based on speeds
-        float closing_speed = ego_speed - target_speed;
-        distance -= closing_speed * dt;
-        distance  = std::max(distance, 2.0f);  // physical minimum (collision)
+        distance = std::max(distance, 2.0f);
 
         // Reset state each cycle (features write fresh outputs)
         state              = VehicleState{};
-        state.ego_speed_mps = ego_speed;
-
-        // Publish sensor data to all features
-        mgr.publish(EventType::SPEED_UPDATE, SpeedData{ego_speed});
-        mgr.publish(EventType::RADAR_UPDATE, RadarData{distance, target_speed, 0.95f});
-        mgr.publish(EventType::LANE_UPDATE,  LaneData{lateral_dev, 0.9f});
-
-        // Run all features
+        state.ego_speed_mps = world.speed(ego);
         mgr.execute(state, t_ms);
 
-        // Apply acceleration to ego speed (physics integration)
-        if (state.brake_requested) {
-            ego_speed += state.ego_acceleration * dt;
-            if (event.empty()) event = "<< AEB/ACC ACTIVE";
-        } else {
-            ego_speed += state.ego_acceleration * dt;
-        }
-        ego_speed = std::max(0.0f, ego_speed);
+        // Feed commanded acceleration and AEB braking back into the world
+        if (!collided) adapter.applyOutputs(world, state);
+        if (state.brake_requested && event.empty()) event = "<< AEB/ACC ACTIVE";
 
         // Print every 200ms to keep output readable
-        if (step % 2 == 0) {
-            printStep(t_ms, state, distance, target_speed, event);
+        if (t_ms % 200 == 0) {
+            printStep(t_ms, state, distance, world.speed(target), event);
+        }
+    });
+
+    const std::size_t events = sched.runUntil(10'000'000);
+    std::cout << "\n" << events << " events over 10 s of simulated time\n";
+    printSignalTimeouts(mgr);
+
+    std::cout << "\nSensor-to-actuator latency per path (simulated µs):\n";
+    mgr.latency().writeJson(std::cout);
+
+    std::cout << "\nRun KPIs:\n";
+    mgr.kpis().writeJson(std::cout);
+
+    if (const ShadowRunner* shadow = mgr.shadow()) {
+        shadow->drain();
+        const ShadowStats s = shadow->stats();
+        std::cout << "\nShadow (full-brake TTC " << g_shadow_full_ttc << " s): "
+                  << shadow->divergentCycles() << " of " << shadow->cyclesCompared()
+                  << " cycles diverged, " << s.dropped << " items dropped\n"
+                  << "Enqueue cost on the control thread: mean "
+                  << s.total_enqueue_ns / std::max<uint64_t>(s.enqueued + s.dropped, 1)
+                  << " ns, max " << s.max_enqueue_ns << " ns\n";
+        for (const ShadowDivergence& d : shadow->divergences()) {
+            if (d.field != ShadowField::BRAKE_INTENSITY) continue;
+            std::cout << "  first brake divergence at " << d.time_ms << " ms: production "
+                      << d.production << ", candidate " << d.candidate << "\n";
+            break;
         }
-
-        // Real-time pacing (comment out for instant output)
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
 }
 
 // ── Scenario B: Door Open Warning ────────────────────────────────────────────
 // Vehicle is parked with door open. Cyclist approaches from behind.
+// The rear corner radar only sees 30 m, so nothing is simulated until the
+// cyclist enters its field: the clock jumps straight there.
 static void scenarioDoorWarning() {
     std::cout << "\n=== LIVE: Door Open Warning Scenario (6 seconds) ===\n";
     std::cout << "Vehicle parked, door open. Cyclist approaching at 5 m/s.\n\n";
     printHeader();
 
+    EventScheduler sched;
     AdasManager mgr;
+    mgr.setClock([&sched] { return sched.now(); });
     VehicleState state;
 
-    float cyclist_dist = 40.0f;
-    const float cyclist_speed = 5.0f;
-    const float dt = 0.1f;
-
-    for (int step = 0; step <= 60; ++step) {
-        uint64_t t_ms = step * 100;
+    World world(0.01f);
+    const ActorId ego     = world.addActor(0.0f,   0.0f, 0.0f);  // parked
+    const ActorId cyclist = world.addActor(-40.0f, 0.8f, 5.0f);  // passes close to the door
+    constexpr float kRadarRange = 30.0f;
+    const RadarSensor rear_radar(kRadarRange, 0.9f, RadarSensor::Facing::REAR);
+    const LaneSensor  lane;
+
+    const auto wall_start = std::chrono::steady_clock::now();
+    auto sync = [&](uint64_t now_us) {
+        paceTo(wall_start, now_us);
+        world.advanceTo(now_us * 1e-6);
+    };
+
+    // Radar at 20 Hz from the moment the cyclist can be seen; each detection
+    // runs a control cycle. A cyclist already in range enters at t = 0.
+    const float    gap_m    = world.position(ego) - world.position(cyclist);
+    const float    entry_s  = std::max(0.0f, (gap_m - kRadarRange) / world.speed(cyclist));
+    const auto     entry_ms = static_cast<uint64_t>(entry_s * 1000.0f);
+    const uint64_t first_us = (entry_ms / 50 + 1) * 50'000;  // first 50 ms slot inside the range
+    int            detections = 0;
+
+    // Speed, lane and door at 10 Hz alongside the radar, inside the input
+    // watchdog's timeouts
+    sched.every(100'000, first_us, Phase::SENSOR, [&](uint64_t now_us) {
+        sync(now_us);
+        mgr.publish(EventType::SPEED_UPDATE, SpeedData{world.speed(ego)});
+        mgr.publish(EventType::LANE_UPDATE,  lane.sense(world, ego));
+        mgr.publish(EventType::DOOR_UPDATE,  DoorData{true});
+    });
+    sched.every(50'000, first_us, Phase::SENSOR, [&](uint64_t now_us) {
+        sync(now_us);
+        // Cyclist alongside the door: hold it there (radar minimum range)
+        if (world.position(cyclist) > world.position(ego) - 0.5f) {
+            world.setSpeed(cyclist, 0.0f);
+        }
 
-        cyclist_dist -= cyclist_speed * dt;
-        cyclist_dist  = std::max(cyclist_dist, 0.5f);
+        const RadarData radar = rear_radar.sense(world, ego);
+        mgr.publish(EventType::RADAR_UPDATE, radar);
 
         state = VehicleState{};
         state.door_open = true;
-
-        mgr.publish(EventType::SPEED_UPDATE, SpeedData{0.0f});
-        mgr.publish(EventType::RADAR_UPDATE, RadarData{cyclist_dist, cyclist_speed, 0.9f});
-        mgr.publish(EventType::LANE_UPDATE,  LaneData{0.0f, 0.9f});
-        mgr.publish(EventType::DOOR_UPDATE,  DoorData{true});
+        const uint64_t t_ms = now_us / 1000;
         mgr.execute(state, t_ms);
 
         std::string event = state.dow_warning ? "<< DOW WARNING!" : "";
+        const bool first = (detections++ == 0);
+        if (first) event = "<< CYCLIST IN RADAR RANGE";
 
-        if (step % 2 == 0) {
-            printStep(t_ms, state, cyclist_dist, cyclist_speed, event);
+        if (first || t_ms % 200 == 0) {
+            printStep(t_ms, state, radar.distance_m, world.speed(cyclist), event);
         }
+    });
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
+    const std::size_t events = sched.runUntil(6'000'000);
+    std::cout << "\n" << events << " events over 6 s of simulated time\n";
+    printSignalTimeouts(mgr);
 }
 
 int main(int argc, char* argv[]) {
@@ -170,11 +308,45 @@ int main(int argc, char* argv[]) {
 
     // Default: run both scenarios
     // Pass "aeb" or "dow" as argument to run just one
-    std::string mode = (argc > 1) ? argv[1] : "all";
+    // Pass "--fast" to run without real-time pacing
+    // Pass "--shadow-full-ttc S" to trial an AEB full-brake TTC in shadow mode
+    // Pass "--trace FILE" to record a Chrome/Perfetto trace of every cycle
+    std::string mode = "all";
+    std::string trace_path;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--trace" && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else if (arg == "--fast") {
+            g_realtime = false;
+        } else if (arg == "--shadow-full-ttc" && i + 1 < argc) {
+            if (!parseSeconds(argv[++i], g_shadow_full_ttc)) {
+                usage();
+                return 1;
+            }
+        } else {
+            mode = arg;
+        }
+    }
+    if (!trace_path.empty()) {
+#if !ADAS_ENABLE_TRACE
+        std::cerr << "warning: built without ADAS_ENABLE_TRACE, the trace will be empty\n";
+#endif
+        trace::start();
+    }
 
     if (mode == "aeb" || mode == "all") scenarioEmergencyBrake();
     if (mode == "dow" || mode == "all") scenarioDoorWarning();
 
     std::cout << "\nSimulation complete.\n";
+
+    if (!trace_path.empty()) {
+        trace::stop();
+        if (!trace::writeChromeJson(trace_path)) {
+            std::cerr << "cannot write trace: " << trace_path << "\n";
+            return 1;
+        }
+        std::cout << "Trace: " << trace::spanCount() << " spans written to " << trace_path << "\n";
+    }
     return 0;
 }
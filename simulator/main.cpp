@@ -2,6 +2,7 @@
 #include <iomanip>
 #include <string>
 #include "adas/features/AdasManager.hpp"
+#include "adas/trace/Trace.hpp"
 #include "adas/VehicleState.hpp"
 
 using namespace adas;
@@ -22,10 +23,28 @@ static void printState(const VehicleState& s, uint64_t t_ms, const char* label)
               << "\n";
 }
 
-int main() {
+// Pass "--trace FILE" to record a Chrome/Perfetto trace of the scenarios.
+int main(int argc, char* argv[]) {
     std::cout << "ADAS Feature Suite - Simulator\n";
     std::cout << "==============================\n";
 
+    std::string trace_path;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--trace" && i + 1 < argc) {
+            trace_path = argv[++i];
+        } else {
+            std::cerr << "usage: adas_simulator [--trace FILE]\n";
+            return 1;
+        }
+    }
+    if (!trace_path.empty()) {
+#if !ADAS_ENABLE_TRACE
+        std::cerr << "warning: built without ADAS_ENABLE_TRACE, the trace will be empty\n";
+#endif
+        trace::start();
+    }
+
     // ── Scenario 1: Emergency Brake ──────────────────────────────────────────
     {
         AdasManager mgr;
@@ -37,7 +56,9 @@ int main() {
         std::cout << "Expected: TTC = 0.67s -> AEB full brake\n";
 
         mgr.publish(EventType::SPEED_UPDATE, SpeedData{30.0f});
-        mgr.publish(EventType::RADAR_UPDATE, RadarData{20.0f, 0.0f, 0.95f});
+        for (int scan = 0; scan < 3; ++scan) {  // Confirms the tracker's lead
+            mgr.publish(EventType::RADAR_UPDATE, RadarData{20.0f, 0.0f, 0.95f});
+        }
         mgr.publish(EventType::LANE_UPDATE,  LaneData{0.0f, 0.95f});  // centered
         mgr.execute(state, 1000);
         printState(state, 1000, "result");
@@ -73,7 +94,9 @@ int main() {
         std::cout << "Expected: AEB fires (TTC=1s), ACC decelerates\n";
 
         mgr.publish(EventType::SPEED_UPDATE, SpeedData{30.0f});
-        mgr.publish(EventType::RADAR_UPDATE, RadarData{10.0f, 20.0f, 0.9f});
+        for (int scan = 0; scan < 3; ++scan) {  // Confirms the tracker's lead
+            mgr.publish(EventType::RADAR_UPDATE, RadarData{10.0f, 20.0f, 0.9f});
+        }
         mgr.publish(EventType::LANE_UPDATE,  LaneData{0.0f, 0.9f});
         mgr.execute(state, 3000);
         printState(state, 3000, "result");
@@ -119,5 +142,14 @@ int main() {
     }
 
     std::cout << "\nSimulation complete.\n";
+
+    if (!trace_path.empty()) {
+        trace::stop();
+        if (!trace::writeChromeJson(trace_path)) {
+            std::cerr << "cannot write trace: " << trace_path << "\n";
+            return 1;
+        }
+        std::cout << "Trace: " << trace::spanCount() << " spans written to " << trace_path << "\n";
+    }
     return 0;
 }
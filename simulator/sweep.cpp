@@ -0,0 +1,175 @@
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "adas/sim/ParameterSweep.hpp"
+#include "adas/sim/ShardedSweep.hpp"
+
+using namespace adas::sim;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Calibration sweep — runs the live_sim target-braking scenario over a grid of
+// AEB/ACC calibrations and writes activation, minimum-gap and collision maps.
+//
+//   adas_sweep --out DIR [--threads N] --axis NAME:MIN:MAX:STEPS [--axis ...]
+//
+// Without --axis, sweeps the four production tunables 10 steps each.
+//
+// Sharded campaigns split the grid into shards checkpointed under DIR, so a
+// sweep can use several processes or hosts and resume after an interruption:
+//
+//   adas_sweep --campaign DIR --procs N --out DIR [--shard-points N] --axis ...
+//   adas_sweep --campaign DIR --worker [--shard-points N] --axis ...
+//
+// The first forks N local workers and merges the shards into --out; the second
+// joins a campaign (e.g. from another host on a shared filesystem) as one
+// worker. Every participant must pass the same axes and shard size.
+// ─────────────────────────────────────────────────────────────────────────────
+
+static void usage() {
+    std::cout << "usage: adas_sweep --out DIR [--threads N] --axis NAME:MIN:MAX:STEPS ...\n"
+              << "       adas_sweep --campaign DIR --procs N --out DIR [--shard-points N] --axis ...\n"
+              << "       adas_sweep --campaign DIR --worker [--threads N] [--shard-points N] --axis ...\n"
+              << "axis names: aeb_full_brake_ttc aeb_partial_brake_ttc acc_min_gap\n"
+              << "            acc_speed_gain acc_gap_gain ego_speed target_decel initial_distance\n";
+}
+
+// Whole-string numbers: trailing junk, overflow and (for counts) a sign fail.
+static bool parseFloat(const std::string& text, float& value) {
+    if (text.empty()) return false;
+    char* end = nullptr;
+    errno     = 0;
+    value     = std::strtof(text.c_str(), &end);
+    return errno == 0 && *end == '\0' && std::isfinite(value);
+}
+
+static bool parseCount(const std::string& text, unsigned long& value) {
+    if (text.empty() || text[0] == '-' || text[0] == '+') return false;
+    char* end = nullptr;
+    errno     = 0;
+    value     = std::strtoul(text.c_str(), &end, 10);
+    return errno == 0 && *end == '\0';
+}
+
+static bool parseAxis(const std::string& spec, SweepAxis& axis) {
+    std::size_t a = spec.find(':');
+    std::size_t b = spec.find(':', a + 1);
+    std::size_t c = spec.find(':', b + 1);
+    if (a == std::string::npos || b == std::string::npos || c == std::string::npos) return false;
+    if (!parseSweepParam(spec.substr(0, a), axis.param)) return false;
+    unsigned long steps = 0;
+    if (!parseFloat(spec.substr(a + 1, b - a - 1), axis.min) ||
+        !parseFloat(spec.substr(b + 1, c - b - 1), axis.max) ||
+        !parseCount(spec.substr(c + 1), steps)) {
+        return false;
+    }
+    if (steps == 0 || steps > UINT32_MAX || axis.min > axis.max) return false;
+    axis.steps = static_cast<uint32_t>(steps);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    SweepConfig config;
+    std::string out_dir;
+    unsigned    threads = 0;
+    std::string campaign_dir;
+    unsigned    procs        = 0;
+    bool        worker       = false;
+    std::size_t shard_points = 4096;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string   arg = argv[i];
+        unsigned long count = 0;
+        if (arg == "--out" && i + 1 < argc) {
+            out_dir = argv[++i];
+        } else if (arg == "--threads" && i + 1 < argc && parseCount(argv[i + 1], count)) {
+            threads = static_cast<unsigned>(count);
+            ++i;
+        } else if (arg == "--campaign" && i + 1 < argc) {
+            campaign_dir = argv[++i];
+        } else if (arg == "--procs" && i + 1 < argc && parseCount(argv[i + 1], count)) {
+            procs = static_cast<unsigned>(count);
+            ++i;
+        } else if (arg == "--shard-points" && i + 1 < argc && parseCount(argv[i + 1], count) && count > 0) {
+            shard_points = count;
+            ++i;
+        } else if (arg == "--worker") {
+            worker = true;
+        } else if (arg == "--axis" && i + 1 < argc) {
+            SweepAxis axis{};
+            if (!parseAxis(argv[++i], axis)) {
+                std::cerr << "bad axis: " << argv[i]
+                          << " (want NAME:MIN:MAX:STEPS with MIN <= MAX and STEPS >= 1)\n";
+                usage();
+                return 1;
+            }
+            config.axes.push_back(axis);
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (out_dir.empty() && !(worker && !campaign_dir.empty())) {
+        usage();
+        return 1;
+    }
+
+    if (config.axes.empty()) {
+        config.axes = {
+            {SweepParam::AEB_FULL_BRAKE_TTC,    0.5f,  2.5f,  10},
+            {SweepParam::AEB_PARTIAL_BRAKE_TTC, 2.0f,  5.0f,  10},
+            {SweepParam::ACC_MIN_GAP,           10.0f, 50.0f, 10},
+            {SweepParam::ACC_SPEED_GAIN,        0.1f,  1.0f,  10},
+        };
+    }
+
+    ParameterSweep sweep(config);
+    std::cout << "Sweeping " << sweep.size() << " grid points...\n";
+
+    auto      start = std::chrono::steady_clock::now();
+    SweepMaps maps;
+    if (campaign_dir.empty()) {
+        maps = sweep.run(threads);
+    } else {
+        ShardedSweep shards(sweep, campaign_dir, shard_points);
+        if (!shards.prepare()) {
+            std::cerr << "campaign " << campaign_dir << " was started with a different config\n";
+            return 1;
+        }
+        const std::size_t recovered = shards.recoverStaleClaims();
+        if (recovered > 0) std::cout << "Recovered " << recovered << " abandoned shards\n";
+        std::cout << shards.completedShards() << "/" << shards.shardCount() << " shards already done\n";
+
+        if (worker) {
+            std::size_t failed = 0;
+            std::cout << "Completed " << shards.work(threads, &failed) << " shards\n";
+            if (failed > 0) {
+                std::cerr << failed << " shards failed and were released\n";
+                return 1;
+            }
+            return 0;
+        }
+        if (!shards.runLocal(procs)) std::cerr << "a worker process failed\n";
+        if (!shards.merge(maps)) {
+            std::cerr << shards.completedShards() << "/" << shards.shardCount()
+                      << " shards done; rerun to resume\n";
+            return 1;
+        }
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    if (!sweep.writeMaps(maps, out_dir)) {
+        std::cerr << "failed to write maps to " << out_dir << "\n";
+        return 1;
+    }
+
+    std::size_t collisions = 0;
+    for (uint8_t c : maps.collision) collisions += c;
+    std::cout << "Done in " << elapsed.count() << " s ("
+              << static_cast<double>(sweep.size()) / elapsed.count() << " points/s), "
+              << collisions << " collisions. Maps written to " << out_dir << "\n";
+    return 0;
+}
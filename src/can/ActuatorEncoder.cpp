@@ -0,0 +1,98 @@
+#include "adas/can/ActuatorEncoder.hpp"
+#include <cmath>
+#include <utility>
+
+namespace adas {
+namespace can {
+
+namespace {
+
+// Fixed frame layouts, Intel byte order.
+struct MessageDef {
+    uint32_t  id;
+    uint8_t   length;
+    CanSignal flag;   // Length 0: message has no flag
+    CanSignal value;  // Length 0: message has no value
+};
+
+constexpr MessageDef kFrames[] = {
+    {0x200, 3, {0, 1, ByteOrder::INTEL, false, 1.0f, 0.0f},              // brake_requested
+               {8, 16, ByteOrder::INTEL, false, 0.0001f, 0.0f}},        // brake_intensity
+    {0x201, 2, {0, 0, ByteOrder::INTEL, false, 1.0f, 0.0f},
+               {0, 16, ByteOrder::INTEL, true,  0.001f, 0.0f}},         // ego_acceleration
+    {0x202, 2, {0, 0, ByteOrder::INTEL, false, 1.0f, 0.0f},
+               {0, 16, ByteOrder::INTEL, true,  0.0001f, 0.0f}},        // steering_angle_rad
+    {0x203, 1, {0, 1, ByteOrder::INTEL, false, 1.0f, 0.0f},              // dow_warning
+               {0, 0, ByteOrder::INTEL, false, 1.0f, 0.0f}},
+};
+
+enum Message : std::size_t { BRAKE, ACCEL, STEER, DOW };
+
+} // namespace
+
+ActuatorEncoder::ActuatorEncoder(Sink sink, const ActuatorOutputConfig& config)
+    : sink_(std::move(sink)), cfg_(config) {}
+
+std::size_t ActuatorEncoder::update(const VehicleState& state, uint64_t time_us) {
+    const float brake = state.brake_requested ? state.brake_intensity : 0.0f;
+    const bool  due_brake = due(channels_[BRAKE], brake, state.brake_requested,
+                                cfg_.brake_deadband, cfg_.brake_refresh_us, time_us);
+    const bool  due_accel = due(channels_[ACCEL], state.ego_acceleration, false,
+                                cfg_.acceleration_deadband, cfg_.acceleration_refresh_us, time_us);
+    const bool  due_steer = due(channels_[STEER], state.steering_angle_rad, false,
+                                cfg_.steering_deadband, cfg_.steering_refresh_us, time_us);
+    const bool  due_dow   = due(channels_[DOW], 0.0f, state.dow_warning,
+                                0.0f, cfg_.dow_refresh_us, time_us);
+
+    // Brake first: it is the one request that must never wait behind the others
+    if (due_brake) send(BRAKE, brake, state.brake_requested, time_us);
+    if (due_accel) send(ACCEL, state.ego_acceleration, false, time_us);
+    if (due_steer) send(STEER, state.steering_angle_rad, false, time_us);
+    if (due_dow)   send(DOW, 0.0f, state.dow_warning, time_us);
+
+    const std::size_t n = std::size_t{due_brake} + due_accel + due_steer + due_dow;
+    suppressed_ += kMessages - n;
+    return n;
+}
+
+void ActuatorEncoder::invalidate() {
+    for (Channel& ch : channels_) ch.sent = false;
+}
+
+bool ActuatorEncoder::due(Channel& ch, float value, bool flag, float deadband,
+                          uint64_t refresh_us, uint64_t time_us) {
+    if (!ch.sent || flag != ch.flag) return true;
+    if (time_us - ch.sent_us >= refresh_us) return true;
+    if (std::abs(value - ch.value) > deadband) return true;
+    // A request that ends must reach the actuator exactly, not as a residue
+    return value == 0.0f && ch.value != 0.0f;
+}
+
+void ActuatorEncoder::send(std::size_t message, float value, bool flag, uint64_t time_us) {
+    static const auto compiled = [] {
+        std::array<std::pair<CompiledSignal, CompiledSignal>, kMessages> out{};
+        for (std::size_t m = 0; m < kMessages; ++m) {
+            out[m] = {compile(kFrames[m].flag), compile(kFrames[m].value)};
+        }
+        return out;
+    }();
+    const MessageDef& def = kFrames[message];
+
+    CanFrame frame;
+    frame.time_us = time_us;
+    frame.id      = def.id;
+    frame.length  = def.length;
+    if (def.flag.length > 0) insert(compiled[message].first, flag ? 1.0f : 0.0f, frame.data.data());
+    if (def.value.length > 0) insert(compiled[message].second, value, frame.data.data());
+    sink_(frame);
+
+    Channel& ch = channels_[message];
+    ch.value   = value;
+    ch.flag    = flag;
+    ch.sent    = true;
+    ch.sent_us = time_us;
+    ++sent_;
+}
+
+} // namespace can
+} // namespace adas
@@ -0,0 +1,248 @@
+#include "adas/can/CanDecoder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+namespace adas {
+namespace can {
+
+namespace {
+
+uint64_t loadLe64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+void storeLe64(uint8_t* p, uint64_t v) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    std::memcpy(p, &v, sizeof(v));
+}
+
+// ── Message table ────────────────────────────────────────────────────────────
+
+constexpr std::size_t kMaxSignals = 3;
+
+struct MessageDef {
+    uint32_t          id;
+    events::EventType type;
+    uint8_t           min_length;  // Bytes needed to hold every signal
+    uint8_t           signal_count;
+    CanSignal         signals[kMaxSignals];
+};
+
+constexpr MessageDef kMessages[] = {
+    {0x120, events::EventType::RADAR_UPDATE, 5, 3, {
+        {0,  16, ByteOrder::INTEL, false, 0.02f,  0.0f},   // distance_m
+        {16, 16, ByteOrder::INTEL, true,  0.01f,  0.0f},   // target_speed_mps
+        {32, 8,  ByteOrder::INTEL, false, 0.004f, 0.0f}}}, // confidence
+    {0x130, events::EventType::SPEED_UPDATE, 2, 1, {
+        {7,  16, ByteOrder::MOTOROLA, false, 0.01f, 0.0f}}},  // speed_mps
+    {0x140, events::EventType::LANE_UPDATE, 3, 2, {
+        {0,  16, ByteOrder::INTEL, true,  0.001f, 0.0f},   // lateral_deviation_m
+        {16, 8,  ByteOrder::INTEL, false, 0.004f, 0.0f}}}, // confidence
+    {0x150, events::EventType::DOOR_UPDATE, 1, 1, {
+        {0,  1,  ByteOrder::INTEL, false, 1.0f,   0.0f}}}, // is_open
+};
+constexpr std::size_t kMessageCount = sizeof(kMessages) / sizeof(kMessages[0]);
+
+struct CompiledMessage {
+    events::EventType type;
+    uint8_t           min_length;
+    CompiledSignal    signals[kMaxSignals];
+};
+
+// Built once, on first use.
+const CompiledMessage* compiledMessages() {
+    static const auto table = [] {
+        std::array<CompiledMessage, kMessageCount> out{};
+        for (std::size_t m = 0; m < kMessageCount; ++m) {
+            out[m].type       = kMessages[m].type;
+            out[m].min_length = kMessages[m].min_length;
+            for (std::size_t s = 0; s < kMessages[m].signal_count; ++s) {
+                out[m].signals[s] = compile(kMessages[m].signals[s]);
+            }
+        }
+        return out;
+    }();
+    return table.data();
+}
+
+int hexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+} // namespace
+
+// ── Signal extraction ────────────────────────────────────────────────────────
+
+CompiledSignal compile(const CanSignal& signal) {
+    CompiledSignal c{};
+    const unsigned length = std::min<unsigned>(std::max<unsigned>(signal.length, 1), 32);
+    c.byte       = static_cast<uint8_t>(signal.start_bit / 8);
+    c.big_endian = signal.order == ByteOrder::MOTOROLA;
+    // A big-endian window puts the first byte in bits 63..56, so the MSB of
+    // a Motorola signal sits at 56 + its bit within that byte.
+    c.shift  = c.big_endian ? static_cast<uint8_t>(56 + signal.start_bit % 8 - (length - 1))
+                            : static_cast<uint8_t>(signal.start_bit % 8);
+    c.mask   = (uint64_t{1} << length) - 1;
+    c.sign   = signal.is_signed ? uint64_t{1} << (length - 1) : 0;
+    c.scale  = signal.scale;
+    c.offset = signal.offset;
+    return c;
+}
+
+float extract(const CompiledSignal& s, const uint8_t* data) {
+    const uint64_t le     = loadLe64(data + s.byte);
+    const uint64_t be     = __builtin_bswap64(le);
+    const uint64_t select = 0 - static_cast<uint64_t>(s.big_endian);  // all ones for big endian
+    const uint64_t window = (be & select) | (le & ~select);
+    const uint64_t raw    = (window >> s.shift) & s.mask;
+    // Sign-extend by flipping and subtracting the sign bit (a no-op when 0).
+    const auto value = static_cast<int64_t>((raw ^ s.sign) - s.sign);
+    return static_cast<float>(value) * s.scale + s.offset;
+}
+
+void insert(const CompiledSignal& s, float value, uint8_t* data) {
+    const double  min_raw = s.sign ? -static_cast<double>(s.sign) : 0.0;
+    const double  max_raw = s.sign ? static_cast<double>(s.sign) - 1.0 : static_cast<double>(s.mask);
+    const double  scaled  = std::round((static_cast<double>(value) - s.offset) / s.scale);
+    const int64_t raw     = static_cast<int64_t>(std::min(std::max(scaled, min_raw), max_raw));
+
+    uint64_t window = loadLe64(data + s.byte);
+    if (s.big_endian) window = __builtin_bswap64(window);
+    window = (window & ~(s.mask << s.shift)) | ((static_cast<uint64_t>(raw) & s.mask) << s.shift);
+    if (s.big_endian) window = __builtin_bswap64(window);
+    storeLe64(data + s.byte, window);
+}
+
+// ── CanDecoder ───────────────────────────────────────────────────────────────
+
+CanDecoder::CanDecoder() {
+    index_.fill(kNoMessage);
+    for (std::size_t m = 0; m < kMessageCount; ++m) {
+        index_[kMessages[m].id] = static_cast<uint8_t>(m);
+    }
+}
+
+bool CanDecoder::decode(const CanFrame& frame, events::EventType& type,
+                        events::EventData& data) const {
+    if (frame.extended || frame.id >= index_.size() || index_[frame.id] == kNoMessage) return false;
+    const CompiledMessage& msg = compiledMessages()[index_[frame.id]];
+    if (frame.length < msg.min_length) return false;
+
+    const uint8_t*        bytes = frame.data.data();
+    const CompiledSignal* sig   = msg.signals;
+    events::EventStamp    stamp;
+    stamp.acquired_us = frame.time_us;
+
+    type = msg.type;
+    switch (msg.type) {
+        case events::EventType::RADAR_UPDATE:
+            data = events::RadarData{extract(sig[0], bytes), extract(sig[1], bytes),
+                                     extract(sig[2], bytes), stamp};
+            return true;
+        case events::EventType::SPEED_UPDATE:
+            data = events::SpeedData{extract(sig[0], bytes), stamp};
+            return true;
+        case events::EventType::LANE_UPDATE:
+            data = events::LaneData{extract(sig[0], bytes), extract(sig[1], bytes), stamp};
+            return true;
+        case events::EventType::DOOR_UPDATE:
+            data = events::DoorData{extract(sig[0], bytes) != 0.0f, stamp};
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool CanDecoder::feed(const CanFrame& frame, features::AdasManager& mgr) const {
+    events::EventType type;
+    events::EventData data;
+    if (!decode(frame, type, data)) return false;
+    mgr.publish(type, std::move(data));
+    return true;
+}
+
+// ── candump ──────────────────────────────────────────────────────────────────
+
+bool parseCandumpLine(const std::string& line, CanFrame& frame) {
+    const char* p   = line.c_str();
+    const char* end = p + line.size();
+    frame = CanFrame{};
+
+    // "(seconds.micros)"
+    while (p < end && *p == ' ') ++p;
+    if (p < end && *p == '(') {
+        uint64_t seconds = 0, micros = 0;
+        int      digits  = 0;
+        for (++p; p < end && *p >= '0' && *p <= '9'; ++p) seconds = seconds * 10 + (*p - '0');
+        if (p < end && *p == '.') {
+            for (++p; p < end && *p >= '0' && *p <= '9'; ++p) {
+                if (digits++ < 6) micros = micros * 10 + (*p - '0');
+            }
+        }
+        for (; digits < 6; ++digits) micros *= 10;
+        if (p >= end || *p != ')') return false;
+        frame.time_us = seconds * 1'000'000 + micros;
+        ++p;
+    }
+
+    // Interface name
+    while (p < end && *p == ' ') ++p;
+    while (p < end && *p != ' ') ++p;
+    while (p < end && *p == ' ') ++p;
+
+    // "ID#DATA" or "ID##FLAGS DATA"
+    // At most 8 digits (an extended id), so a long id cannot wrap into range.
+    const char* id_start = p;
+    for (int d; p < end && (d = hexDigit(*p)) >= 0; ++p) {
+        if (p - id_start == 8) return false;
+        frame.id = frame.id * 16 + d;
+    }
+    frame.extended = (p - id_start == 8);
+    if (p == id_start || p >= end || *p != '#' ||
+        frame.id >= (frame.extended ? 0x20000000u : 0x800u)) {
+        return false;
+    }
+    ++p;
+    if (p < end && *p == '#') {
+        frame.fd = true;
+        p += 2;  // Flags nibble
+        if (p > end) return false;
+    }
+
+    const std::size_t capacity = frame.fd ? CanFrame::kMaxData : 8;
+    while (p < end && *p != ' ' && *p != '\r') {
+        if (*p == '.') {  // Optional byte separator
+            ++p;
+            continue;
+        }
+        const int hi = hexDigit(*p);
+        const int lo = (p + 1 < end) ? hexDigit(p[1]) : -1;
+        if (hi < 0 || lo < 0 || frame.length >= capacity) return false;  // Also rejects "R" (remote)
+        frame.data[frame.length++] = static_cast<uint8_t>(hi * 16 + lo);
+        p += 2;
+    }
+    return true;
+}
+
+bool CandumpReader::next(CanFrame& frame) {
+    while (std::getline(in_, line_)) {
+        if (parseCandumpLine(line_, frame)) return true;
+        if (!line_.empty()) ++skipped_;
+    }
+    return false;
+}
+
+} // namespace can
+} // namespace adas
@@ -1,20 +1,196 @@
 #include "adas/diagnostics/DTCManager.hpp"
+#include "adas/common/SpscQueue.hpp"
+#include "adas/trace/Trace.hpp"
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <utility>
 
 namespace adas {
 namespace diagnostics {
 
+// ── Posted reports ───────────────────────────────────────────────────────────
+
+struct DTCManager::PostBuffer {
+    common::SpscQueue<Posted> queue{kPostCapacity};  // Producer: the owning thread
+    std::atomic<uint64_t>     dropped{0};
+    std::atomic<bool>         exited{false};         // Set once the owner stopped posting
+};
+
+// Owns the buffers, so moving the manager keeps every thread's buffer.
+// Each posting thread also holds a reference, to flag its buffers on exit.
+struct DTCManager::PostRegistry {
+    uint64_t   id;  // Never reused, unlike the manager's address
+    std::mutex mutex;
+    std::vector<std::pair<std::thread::id, std::shared_ptr<PostBuffer>>> buffers;
+    uint64_t   reclaimed_dropped = 0;  // Drops counted by freed buffers
+};
+
+namespace {
+std::atomic<uint64_t> g_next_registry_id{1};
+} // namespace
+
+DTCManager::DTCManager() : posts_(std::make_unique<PostRegistry>()) {
+    posts_->id = g_next_registry_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+DTCManager::~DTCManager() = default;
+DTCManager::DTCManager(DTCManager&&) noexcept = default;
+DTCManager& DTCManager::operator=(DTCManager&&) noexcept = default;
+
+DTCManager::PostBuffer* DTCManager::localBuffer() {
+    // Recently used buffers of this thread, so posting skips the registry lock.
+    struct CacheEntry {
+        uint64_t    registry = 0;
+        PostBuffer* buffer   = nullptr;
+    };
+    static thread_local std::array<CacheEntry, 4> cache{};
+    static thread_local std::size_t               next_victim = 0;
+
+    // Flags this thread's buffers on exit, so mergePosted() can free them.
+    struct Owned {
+        std::vector<std::shared_ptr<PostBuffer>> buffers;
+        ~Owned() {
+            for (auto& b : buffers) b->exited.store(true, std::memory_order_release);
+        }
+    };
+    static thread_local Owned owned;
+
+    for (const CacheEntry& c : cache) {
+        if (c.registry == posts_->id) return c.buffer;
+    }
+
+    PostBuffer* buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(posts_->mutex);
+        const std::thread::id self = std::this_thread::get_id();
+        for (auto& [thread, b] : posts_->buffers) {
+            // An exited thread's id may have been handed to this one
+            if (thread == self && !b->exited.load(std::memory_order_relaxed)) buffer = b.get();
+        }
+        if (!buffer) {
+            auto fresh = std::make_shared<PostBuffer>();
+            posts_->buffers.emplace_back(self, fresh);
+            buffer = fresh.get();
+            // Drop buffers whose manager is gone before taking another
+            owned.buffers.erase(std::remove_if(owned.buffers.begin(), owned.buffers.end(),
+                                               [](const auto& b) { return b.use_count() == 1; }),
+                                owned.buffers.end());
+            owned.buffers.push_back(std::move(fresh));
+        }
+    }
+    cache[next_victim] = {posts_->id, buffer};
+    next_victim        = (next_victim + 1) % cache.size();
+    return buffer;
+}
+
+void DTCManager::post(DTC code, Severity severity, const char* message, uint64_t timestamp_ms) {
+    if (!posts_) return;
+    PostBuffer* buffer = localBuffer();
+    Posted p;
+    p.code         = code;
+    p.severity     = severity;
+    p.timestamp_ms = timestamp_ms;
+    std::strncpy(p.message.data(), message, kPostedMessageLength);
+    if (!buffer->queue.push(p)) buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::size_t DTCManager::mergePosted() {
+    if (!posts_) return 0;
+    merge_scratch_.clear();
+    {
+        // Only blocks a thread posting for the first time.
+        std::lock_guard<std::mutex> lock(posts_->mutex);
+        Posted p;
+        auto& buffers = posts_->buffers;
+        for (std::size_t i = 0; i < buffers.size();) {
+            PostBuffer& b = *buffers[i].second;
+            // Read before draining: an exited owner's last post is then seen too
+            const bool exited = b.exited.load(std::memory_order_acquire);
+            while (b.queue.pop(p)) merge_scratch_.push_back(p);
+            if (!exited) {
+                ++i;
+                continue;
+            }
+            posts_->reclaimed_dropped += b.dropped.load(std::memory_order_relaxed);
+            buffers[i] = std::move(buffers.back());
+            buffers.pop_back();
+        }
+    }
+    // Ties on timestamp and code fall back to severity and text: a total
+    // order, so equal reports from different threads can never swap.
+    std::sort(merge_scratch_.begin(), merge_scratch_.end(), [](const Posted& a, const Posted& b) {
+        const auto ka = std::make_tuple(a.timestamp_ms, a.code, a.severity);
+        const auto kb = std::make_tuple(b.timestamp_ms, b.code, b.severity);
+        if (ka != kb) return ka < kb;
+        return std::strcmp(a.message.data(), b.message.data()) < 0;
+    });
+    for (const Posted& p : merge_scratch_) report(p.code, p.severity, p.message.data(), p.timestamp_ms);
+    return merge_scratch_.size();
+}
+
+uint64_t DTCManager::droppedPosts() const {
+    if (!posts_) return 0;
+    std::lock_guard<std::mutex> lock(posts_->mutex);
+    uint64_t dropped = posts_->reclaimed_dropped;
+    for (const auto& entry : posts_->buffers) dropped += entry.second->dropped.load(std::memory_order_relaxed);
+    return dropped;
+}
+
+std::size_t DTCManager::postBuffers() const {
+    if (!posts_) return 0;
+    std::lock_guard<std::mutex> lock(posts_->mutex);
+    return posts_->buffers.size();
+}
+
+// ── Log ──────────────────────────────────────────────────────────────────────
+
 void DTCManager::report(DTC code, Severity severity,
                         const std::string& message, uint64_t timestamp_ms) {
+    ADAS_TRACE_SCOPE_CAT("dtc", "DTCManager::report");
+    const auto pos = static_cast<uint32_t>(entries_.size());
     entries_.push_back({code, severity, timestamp_ms, message});
+
+    // Features report in cycle order, so the common case is an append.
+    // Late reports are inserted after any entries with the same timestamp.
+    if (time_index_.empty() || entries_[time_index_.back()].timestamp_ms <= timestamp_ms) {
+        time_index_.push_back(pos);
+        return;
+    }
+    auto it = std::upper_bound(time_index_.begin(), time_index_.end(), timestamp_ms,
+                               [this](uint64_t t, uint32_t i) {
+                                   return t < entries_[i].timestamp_ms;
+                               });
+    time_index_.insert(it, pos);
 }
 
 void DTCManager::clear(DTC code) {
+    // Map each surviving entry to its new position, then rewrite the index in place.
+    std::vector<uint32_t> remap(entries_.size());
+    uint32_t next = 0;
+    for (std::size_t i = 0; i < entries_.size(); ++i) {
+        remap[i] = (entries_[i].code == code) ? UINT32_MAX : next++;
+    }
+
     entries_.erase(
         std::remove_if(entries_.begin(), entries_.end(),
                        [code](const DTCEntry& e) { return e.code == code; }),
         entries_.end());
+
+    std::size_t out = 0;
+    for (uint32_t i : time_index_) {
+        if (remap[i] != UINT32_MAX) time_index_[out++] = remap[i];
+    }
+    time_index_.resize(out);
+}
+
+void DTCManager::clear() {
+    entries_.clear();
+    time_index_.clear();
 }
 
 bool DTCManager::hasActive(DTC code) const {
@@ -26,15 +202,119 @@ const std::vector<DTCEntry>& DTCManager::entries() const {
     return entries_;
 }
 
+template <typename Fn>
+std::size_t DTCManager::forEachMatch(const DTCQuery& q, Fn&& fn) const {
+    if (q.from_ms > q.to_ms) return 0;
+
+    auto by_time = [this](uint32_t i, uint64_t t) { return entries_[i].timestamp_ms < t; };
+    auto first = std::lower_bound(time_index_.begin(), time_index_.end(), q.from_ms, by_time);
+
+    std::size_t count = 0;
+    for (auto it = first; it != time_index_.end(); ++it) {
+        const DTCEntry& e = entries_[*it];
+        if (e.timestamp_ms > q.to_ms) break;
+        if (q.code && e.code != *q.code) continue;
+        if (q.severity && e.severity != *q.severity) continue;
+        fn(e);
+        ++count;
+    }
+    return count;
+}
+
+std::vector<const DTCEntry*> DTCManager::query(const DTCQuery& q) const {
+    std::vector<const DTCEntry*> result;
+    forEachMatch(q, [&result](const DTCEntry& e) { result.push_back(&e); });
+    return result;
+}
+
+std::size_t DTCManager::exportTo(const DTCQuery& q, IDTCSink& sink) const {
+    std::size_t count = forEachMatch(q, [&sink](const DTCEntry& e) { sink.write(e); });
+    sink.flush();
+    return count;
+}
+
 void DTCManager::dump() const {
     for (const auto& e : entries_) {
-        const char* sev = (e.severity == Severity::INFO)     ? "INFO"
-                        : (e.severity == Severity::WARNING)  ? "WARN"
-                                                             : "CRIT";
-        std::cout << "[DTC][" << sev << "][t=" << e.timestamp_ms << "ms] "
+        std::cout << "[DTC][" << severityLabel(e.severity) << "][t=" << e.timestamp_ms << "ms] "
                   << e.message << "\n";
     }
 }
 
+void DTCManager::saveState(snapshot::SnapshotWriter& out) const {
+    out.write(static_cast<uint32_t>(entries_.size()));
+    for (const auto& e : entries_) {
+        out.write(static_cast<uint16_t>(e.code));
+        out.write(static_cast<uint8_t>(e.severity));
+        out.write(e.timestamp_ms);
+        out.writeString(e.message);
+    }
+    // The index is a permutation of entry positions; storing it avoids a re-sort.
+    for (uint32_t i : time_index_) out.write(i);
+}
+
+void DTCManager::saveState(snapshot::SnapshotWriter& out, std::size_t max_entries) const {
+    if (max_entries >= entries_.size()) {
+        saveState(out);
+        return;
+    }
+    // The newest entries, kept in log order so the saved index is their
+    // timestamp order renumbered.
+    std::vector<uint32_t> kept(time_index_.end() - static_cast<std::ptrdiff_t>(max_entries),
+                               time_index_.end());
+    std::sort(kept.begin(), kept.end());
+    out.write(static_cast<uint32_t>(kept.size()));
+    for (uint32_t i : kept) {
+        const DTCEntry& e = entries_[i];
+        out.write(static_cast<uint16_t>(e.code));
+        out.write(static_cast<uint8_t>(e.severity));
+        out.write(e.timestamp_ms);
+        out.writeString(e.message);
+    }
+    for (std::size_t t = time_index_.size() - max_entries; t < time_index_.size(); ++t) {
+        const auto pos = std::lower_bound(kept.begin(), kept.end(), time_index_[t]);
+        out.write(static_cast<uint32_t>(pos - kept.begin()));
+    }
+}
+
+bool DTCManager::restoreState(snapshot::SnapshotReader& in) {
+    // Each entry takes at least 15 bytes plus 4 in the index, which bounds
+    // the count before anything is allocated for it.
+    constexpr std::size_t kMinEntryBytes = sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint64_t) +
+                                           sizeof(uint32_t) + sizeof(uint32_t);
+    uint32_t count = 0;
+    if (!in.read(count) || count > in.remaining() / kMinEntryBytes) return false;
+
+    std::vector<DTCEntry> entries;
+    entries.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        uint16_t code     = 0;
+        uint8_t  severity = 0;
+        DTCEntry e{};
+        in.read(code);
+        in.read(severity);
+        in.read(e.timestamp_ms);
+        in.readString(e.message);
+        if (!in.ok() || severity > static_cast<uint8_t>(Severity::CRITICAL)) return false;
+        e.code     = static_cast<DTC>(code);
+        e.severity = static_cast<Severity>(severity);
+        entries.push_back(std::move(e));
+    }
+
+    // The index must name every entry once, in timestamp order.
+    std::vector<uint32_t> index(count);
+    std::vector<uint8_t>  seen(count, 0);
+    for (std::size_t k = 0; k < index.size(); ++k) {
+        uint32_t& i = index[k];
+        if (!in.read(i) || i >= count || seen[i]) return false;
+        if (k > 0 && entries[i].timestamp_ms < entries[index[k - 1]].timestamp_ms) return false;
+        seen[i] = 1;
+    }
+    if (!in.atEnd()) return false;
+
+    entries_    = std::move(entries);
+    time_index_ = std::move(index);
+    return true;
+}
+
 } // namespace diagnostics
 } // namespace adas
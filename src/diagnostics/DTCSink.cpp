@@ -0,0 +1,141 @@
+#include "adas/diagnostics/DTCSink.hpp"
+#include <algorithm>
+#include <charconv>
+
+namespace adas {
+namespace diagnostics {
+
+namespace {
+
+void appendUint(std::string& buf, uint64_t value) {
+    char tmp[20];
+    auto res = std::to_chars(tmp, tmp + sizeof(tmp), value);
+    buf.append(tmp, res.ptr);
+}
+
+void appendHexCode(std::string& buf, DTC code) {
+    char tmp[8];
+    auto res = std::to_chars(tmp, tmp + sizeof(tmp), static_cast<unsigned>(code), 16);
+    buf += "0x";
+    buf.append(tmp, res.ptr);
+}
+
+// Little-endian fixed-width integer.
+template <typename T>
+void appendLe(std::string& buf, T value) {
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        buf.push_back(static_cast<char>((static_cast<uint64_t>(value) >> (8 * i)) & 0xFF));
+    }
+}
+
+} // namespace
+
+const char* severityLabel(Severity severity) {
+    return (severity == Severity::INFO)    ? "INFO"
+         : (severity == Severity::WARNING) ? "WARN"
+                                           : "CRIT";
+}
+
+// ── BufferedDTCSink ──────────────────────────────────────────────────────────
+
+BufferedDTCSink::BufferedDTCSink(std::ostream& out, std::size_t buffer_bytes)
+    : out_(out), buffer_bytes_(buffer_bytes) {
+    buffer_.reserve(buffer_bytes_ + 256);
+}
+
+BufferedDTCSink::~BufferedDTCSink() {
+    flush();
+}
+
+void BufferedDTCSink::write(const DTCEntry& entry) {
+    encode(entry, buffer_);
+    if (buffer_.size() >= buffer_bytes_) flush();
+}
+
+void BufferedDTCSink::flush() {
+    if (buffer_.empty()) return;
+    out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    out_.flush();
+    buffer_.clear();
+}
+
+// ── JSON lines ───────────────────────────────────────────────────────────────
+
+void JsonLinesSink::encode(const DTCEntry& e, std::string& buf) {
+    buf += "{\"code\":\"";
+    appendHexCode(buf, e.code);
+    buf += "\",\"severity\":\"";
+    buf += severityLabel(e.severity);
+    buf += "\",\"timestamp_ms\":";
+    appendUint(buf, e.timestamp_ms);
+    buf += ",\"message\":\"";
+    for (char c : e.message) {
+        switch (c) {
+            case '"':  buf += "\\\""; break;
+            case '\\': buf += "\\\\"; break;
+            case '\n': buf += "\\n";  break;
+            case '\r': buf += "\\r";  break;
+            case '\t': buf += "\\t";  break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    static const char kHex[] = "0123456789abcdef";
+                    buf += "\\u00";
+                    buf.push_back(kHex[(c >> 4) & 0xF]);
+                    buf.push_back(kHex[c & 0xF]);
+                } else {
+                    buf.push_back(c);
+                }
+        }
+    }
+    buf += "\"}\n";
+}
+
+// ── CSV ──────────────────────────────────────────────────────────────────────
+
+CsvSink::CsvSink(std::ostream& out, std::size_t buffer_bytes)
+    : BufferedDTCSink(out, buffer_bytes) {
+    buffer_ += "code,severity,timestamp_ms,message\n";
+}
+
+void CsvSink::encode(const DTCEntry& e, std::string& buf) {
+    appendHexCode(buf, e.code);
+    buf.push_back(',');
+    buf += severityLabel(e.severity);
+    buf.push_back(',');
+    appendUint(buf, e.timestamp_ms);
+    buf.push_back(',');
+
+    // Quote the message only when it contains a separator, quote or newline.
+    bool needs_quotes = e.message.find_first_of(",\"\n\r") != std::string::npos;
+    if (!needs_quotes) {
+        buf += e.message;
+    } else {
+        buf.push_back('"');
+        for (char c : e.message) {
+            if (c == '"') buf.push_back('"');
+            buf.push_back(c);
+        }
+        buf.push_back('"');
+    }
+    buf.push_back('\n');
+}
+
+// ── Binary ───────────────────────────────────────────────────────────────────
+
+BinarySink::BinarySink(std::ostream& out, std::size_t buffer_bytes)
+    : BufferedDTCSink(out, buffer_bytes) {
+    buffer_.append(kMagic, sizeof(kMagic));
+    buffer_.push_back(static_cast<char>(kVersion));
+}
+
+void BinarySink::encode(const DTCEntry& e, std::string& buf) {
+    auto len = static_cast<uint16_t>(std::min<std::size_t>(e.message.size(), UINT16_MAX));
+    appendLe(buf, static_cast<uint16_t>(e.code));
+    appendLe(buf, static_cast<uint8_t>(e.severity));
+    appendLe(buf, e.timestamp_ms);
+    appendLe(buf, len);
+    buf.append(e.message.data(), len);
+}
+
+} // namespace diagnostics
+} // namespace adas
@@ -0,0 +1,156 @@
+#include "adas/diagnostics/DiagServer.hpp"
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+namespace adas {
+namespace diagnostics {
+
+namespace {
+
+constexpr int         kPollTimeoutMs = 50;  // How quickly stop() is noticed
+constexpr std::size_t kReplySize     = sizeof(DiagReplyHeader) + sizeof(DiagFrame);
+
+bool socketAddress(const std::string& path, sockaddr_un& addr) {
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(addr.sun_path)) return false;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+bool readAll(int fd, void* data, std::size_t size) {
+    auto* p = static_cast<uint8_t*>(data);
+    while (size > 0) {
+        const ssize_t n = ::recv(fd, p, size, 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+} // namespace
+
+// ── DiagServer ───────────────────────────────────────────────────────────────
+
+bool DiagServer::start(const std::string& path) {
+    sockaddr_un addr;
+    if (thread_.joinable() || !socketAddress(path, addr)) return false;
+
+    listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) return false;
+    ::unlink(path.c_str());
+    if (::bind(listen_fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) < 0 ||
+        ::listen(listen_fd_, kMaxClients) < 0) {
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        return false;
+    }
+    path_ = path;
+    stop_.store(false, std::memory_order_relaxed);
+    thread_ = std::thread([this] { serve(); });
+    return true;
+}
+
+void DiagServer::stop() {
+    if (!thread_.joinable()) return;
+    stop_.store(true, std::memory_order_relaxed);
+    thread_.join();
+    ::close(listen_fd_);
+    listen_fd_ = -1;
+    ::unlink(path_.c_str());
+}
+
+void DiagServer::serve() {
+    // fds[0] is the listening socket, the rest are clients.
+    std::vector<pollfd> fds;
+    fds.push_back({listen_fd_, POLLIN, 0});
+    uint8_t requests[64];
+    uint8_t reply[kReplySize];
+
+    while (!stop_.load(std::memory_order_relaxed)) {
+        if (::poll(fds.data(), fds.size(), kPollTimeoutMs) <= 0) continue;
+
+        if (fds[0].revents & POLLIN) {
+            const int fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+            if (fd >= 0 && fds.size() <= static_cast<std::size_t>(kMaxClients)) {
+                fds.push_back({fd, POLLIN, 0});
+            } else if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+
+        for (std::size_t i = 1; i < fds.size();) {
+            bool keep = true;
+            if (fds[i].revents & (POLLIN | POLLERR | POLLHUP)) {
+                const ssize_t n = ::recv(fds[i].fd, requests, sizeof(requests), MSG_DONTWAIT);
+                keep = n > 0 || (n < 0 && (errno == EAGAIN || errno == EINTR));
+                for (ssize_t r = 0; keep && r < n; ++r) {
+                    if (requests[r] != kDiagRequest) {
+                        keep = false;
+                        break;
+                    }
+                    DiagReplyHeader header;
+                    DiagFrame       frame = source_.read(&header.version);
+                    std::memcpy(reply, &header, sizeof(header));
+                    std::memcpy(reply + sizeof(header), &frame, sizeof(frame));
+                    // A client whose socket buffer is full is not reading: drop it
+                    // rather than wait.
+                    keep = ::send(fds[i].fd, reply, kReplySize, MSG_DONTWAIT | MSG_NOSIGNAL) ==
+                           static_cast<ssize_t>(kReplySize);
+                    if (keep) replies_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            if (keep) {
+                ++i;
+            } else {
+                ::close(fds[i].fd);
+                fds[i] = fds.back();
+                fds.pop_back();
+            }
+        }
+    }
+    for (std::size_t i = 1; i < fds.size(); ++i) ::close(fds[i].fd);
+}
+
+// ── DiagClient ───────────────────────────────────────────────────────────────
+
+bool DiagClient::connect(const std::string& path) {
+    close();
+    sockaddr_un addr;
+    if (!socketAddress(path, addr)) return false;
+    fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) return false;
+    if (::connect(fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) < 0) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void DiagClient::close() {
+    if (fd_ >= 0) ::close(fd_);
+    fd_ = -1;
+}
+
+bool DiagClient::poll(DiagFrame& frame, uint64_t* version) {
+    if (fd_ < 0) return false;
+    if (::send(fd_, &kDiagRequest, 1, MSG_NOSIGNAL) != 1) return false;
+    DiagReplyHeader header;
+    if (!readAll(fd_, &header, sizeof(header)) || header.magic != kDiagMagic ||
+        header.size != sizeof(DiagFrame) || !readAll(fd_, &frame, sizeof(frame))) {
+        close();
+        return false;
+    }
+    if (version) *version = header.version;
+    return true;
+}
+
+} // namespace diagnostics
+} // namespace adas
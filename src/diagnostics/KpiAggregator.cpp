@@ -0,0 +1,146 @@
+#include "adas/diagnostics/KpiAggregator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <variant>
+
+namespace adas {
+namespace diagnostics {
+
+namespace {
+
+// Bucket i >= 1 covers [kMinValue·γ^(i-1), kMinValue·γ^i).
+const double kGamma    = (1.0 + QuantileSketch::kRelativeError) / (1.0 - QuantileSketch::kRelativeError);
+const double kLogGamma = std::log(kGamma);
+
+constexpr float kNoTargetDistance = 999.0f;  // Radar "nothing in range"
+constexpr float kMinClosingSpeed  = 0.1f;    // m/s; slower closing is not a TTC
+
+void writeSketch(std::ostream& out, const char* name, const QuantileSketch& s) {
+    out << ",\n  \"" << name << "\": {"
+        << "\"count\": " << s.count()
+        << ", \"min\": " << s.min()
+        << ", \"mean\": " << s.mean()
+        << ", \"p50\": " << s.quantile(0.50)
+        << ", \"p95\": " << s.quantile(0.95)
+        << ", \"p99\": " << s.quantile(0.99)
+        << ", \"max\": " << s.max() << "}";
+}
+
+} // namespace
+
+// ── QuantileSketch ───────────────────────────────────────────────────────────
+
+void QuantileSketch::record(double value) {
+    value = std::max(value, 0.0);
+    std::size_t bucket = 0;
+    if (value >= kMinValue) {
+        const double i = std::floor(std::log(value / kMinValue) / kLogGamma) + 1.0;
+        bucket = static_cast<std::size_t>(std::min(i, static_cast<double>(kBuckets - 1)));
+    }
+    ++buckets_[bucket];
+    min_ = count_ ? std::min(min_, value) : value;
+    max_ = count_ ? std::max(max_, value) : value;
+    sum_ += value;
+    ++count_;
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.count_ == 0) return;
+    for (std::size_t i = 0; i < kBuckets; ++i) buckets_[i] += other.buckets_[i];
+    min_ = count_ ? std::min(min_, other.min_) : other.min_;
+    max_ = count_ ? std::max(max_, other.max_) : other.max_;
+    sum_   += other.sum_;
+    count_ += other.count_;
+}
+
+double QuantileSketch::quantile(double q) const {
+    if (count_ == 0) return 0.0;
+    const double   clamped = std::min(std::max(q, 0.0), 1.0);
+    const uint64_t rank    = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped * count_)));
+
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+        seen += buckets_[i];
+        if (seen < rank) continue;
+        if (i == 0) return min_;
+        // Point of the bucket with equal relative error to both edges
+        const double lower = kMinValue * std::pow(kGamma, static_cast<double>(i - 1));
+        return std::min(std::max(lower * 2.0 * kGamma / (1.0 + kGamma), min_), max_);
+    }
+    return max_;
+}
+
+// ── KpiAggregator ────────────────────────────────────────────────────────────
+
+void KpiAggregator::onEvent(events::EventType type, const events::EventData& data) {
+    if (type == events::EventType::RADAR_UPDATE) {
+        const auto& r     = std::get<events::RadarData>(data);
+        distance_m_       = r.distance_m;
+        target_speed_mps_ = r.target_speed_mps;
+    } else if (type == events::EventType::SPEED_UPDATE) {
+        ego_speed_mps_ = std::get<events::SpeedData>(data).speed_mps;
+    }
+}
+
+void KpiAggregator::record(const VehicleState& state, uint64_t current_time_ms) {
+    ++counters_.cycles;
+
+    const float closing = ego_speed_mps_ - target_speed_mps_;
+    if (distance_m_ < kNoTargetDistance && closing > kMinClosingSpeed) {
+        ttc_s_.record(distance_m_ / closing);
+    }
+
+    if (state.brake_requested) {
+        ++counters_.aeb_active_cycles;
+        if (!previous_brake_) ++counters_.aeb_activations;
+        brake_.record(state.brake_intensity);
+    }
+    if (state.steering_angle_rad != 0.0f) {
+        ++counters_.lka_active_cycles;
+        steering_rad_.record(std::abs(state.steering_angle_rad));
+    }
+    if (state.dow_warning && !previous_dow_) ++counters_.dow_warnings;
+
+    if (has_previous_ && current_time_ms > previous_ms_) {
+        const double dt_s = (current_time_ms - previous_ms_) * 1e-3;
+        jerk_mps3_.record(std::abs(state.ego_acceleration - previous_accel_) / dt_s);
+    }
+
+    has_previous_   = true;
+    previous_ms_    = current_time_ms;
+    previous_accel_ = state.ego_acceleration;
+    previous_brake_ = state.brake_requested;
+    previous_dow_   = state.dow_warning;
+}
+
+void KpiAggregator::merge(const KpiAggregator& other) {
+    counters_.cycles            += other.counters_.cycles;
+    counters_.aeb_active_cycles += other.counters_.aeb_active_cycles;
+    counters_.aeb_activations   += other.counters_.aeb_activations;
+    counters_.lka_active_cycles += other.counters_.lka_active_cycles;
+    counters_.dow_warnings      += other.counters_.dow_warnings;
+    ttc_s_.merge(other.ttc_s_);
+    jerk_mps3_.merge(other.jerk_mps3_);
+    steering_rad_.merge(other.steering_rad_);
+    brake_.merge(other.brake_);
+}
+
+void KpiAggregator::writeJson(std::ostream& out) const {
+    const double aeb_rate = counters_.cycles
+        ? static_cast<double>(counters_.aeb_active_cycles) / counters_.cycles : 0.0;
+    out << "{\n"
+        << "  \"cycles\": " << counters_.cycles
+        << ",\n  \"aeb_active_cycles\": " << counters_.aeb_active_cycles
+        << ",\n  \"aeb_activations\": " << counters_.aeb_activations
+        << ",\n  \"aeb_active_rate\": " << aeb_rate
+        << ",\n  \"lka_active_cycles\": " << counters_.lka_active_cycles
+        << ",\n  \"dow_warnings\": " << counters_.dow_warnings;
+    writeSketch(out, "ttc_s", ttc_s_);
+    writeSketch(out, "accel_jerk_mps3", jerk_mps3_);
+    writeSketch(out, "steering_rad", steering_rad_);
+    writeSketch(out, "brake_intensity", brake_);
+    out << "\n}\n";
+}
+
+} // namespace diagnostics
+} // namespace adas
@@ -0,0 +1,99 @@
+#include "adas/diagnostics/LatencyTracker.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace adas {
+namespace diagnostics {
+
+const char* toString(Actuator actuator) {
+    switch (actuator) {
+        case Actuator::BRAKE:        return "BRAKE";
+        case Actuator::ACCELERATION: return "ACCELERATION";
+        case Actuator::STEERING:     return "STEERING";
+    }
+    return "UNKNOWN";
+}
+
+// ── LatencyHistogram ─────────────────────────────────────────────────────────
+
+void LatencyHistogram::record(uint64_t latency_us) {
+    std::size_t bucket = 0;
+    if (latency_us > 0) {
+        bucket = 64 - static_cast<std::size_t>(__builtin_clzll(latency_us));
+        bucket = std::min(bucket, kBuckets - 1);
+    }
+    ++buckets_[bucket];
+    ++count_;
+    sum_us_ += latency_us;
+    min_us_  = std::min(min_us_, latency_us);
+    max_us_  = std::max(max_us_, latency_us);
+}
+
+uint64_t LatencyHistogram::quantileUs(double q) const {
+    if (count_ == 0) return 0;
+    const double   clamped = std::min(std::max(q, 0.0), 1.0);
+    const uint64_t rank    = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped * count_)));
+
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+        seen += buckets_[i];
+        if (seen >= rank) return std::min(bucketUpperUs(i), max_us_);
+    }
+    return max_us_;
+}
+
+// ── LatencyTracker ───────────────────────────────────────────────────────────
+
+void LatencyTracker::record(events::EventType source, Actuator actuator, uint64_t latency_us) {
+    paths_[indexOf(source, actuator)].record(latency_us);
+}
+
+void LatencyTracker::recordOutputs(const VehicleState& state, uint64_t now_us) {
+    auto recordInput = [&](const InputStamp& in, Actuator actuator) {
+        if (in.acquired_us == 0) return;
+        record(in.source, actuator, (now_us > in.acquired_us) ? now_us - in.acquired_us : 0);
+    };
+    recordInput(state.brake_input,        Actuator::BRAKE);
+    recordInput(state.acceleration_input, Actuator::ACCELERATION);
+    recordInput(state.steering_input,     Actuator::STEERING);
+}
+
+const LatencyHistogram& LatencyTracker::histogram(events::EventType source,
+                                                  Actuator actuator) const {
+    return paths_[indexOf(source, actuator)];
+}
+
+void LatencyTracker::writeJson(std::ostream& out) const {
+    out << "{";
+    bool first = true;
+    for (std::size_t s = 0; s < kSources; ++s) {
+        for (std::size_t a = 0; a < kActuators; ++a) {
+            const auto source   = static_cast<events::EventType>(s);
+            const auto actuator = static_cast<Actuator>(a);
+            const LatencyHistogram& h = histogram(source, actuator);
+            if (h.count() == 0) continue;
+
+            out << (first ? "\n" : ",\n") << "  \"" << events::toString(source) << "->"
+                << toString(actuator) << "\": {"
+                << "\"count\": " << h.count()
+                << ", \"min_us\": " << h.minUs()
+                << ", \"mean_us\": " << h.meanUs()
+                << ", \"p50_us\": " << h.quantileUs(0.50)
+                << ", \"p99_us\": " << h.quantileUs(0.99)
+                << ", \"max_us\": " << h.maxUs()
+                << ", \"buckets\": [";
+            // Trailing empty buckets are omitted.
+            std::size_t last = LatencyHistogram::kBuckets;
+            while (last > 0 && h.buckets()[last - 1] == 0) --last;
+            for (std::size_t i = 0; i < last; ++i) {
+                out << (i ? ", " : "") << h.buckets()[i];
+            }
+            out << "]}";
+            first = false;
+        }
+    }
+    out << (first ? "}\n" : "\n}\n");
+}
+
+} // namespace diagnostics
+} // namespace adas
@@ -1,19 +1,283 @@
 #include "adas/events/EventBus.hpp"
+#include "adas/trace/Trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <utility>
 
 namespace adas {
 namespace events {
 
-void EventBus::subscribe(EventType type, IEventSubscriber* subscriber) {
-    subscribers_[type].push_back(subscriber);
+namespace {
+
+// ── Publisher thread slots ───────────────────────────────────────────────────
+// Every thread that publishes gets a process-wide index, shared by all buses
+// and returned when the thread exits.
+
+constexpr std::size_t kSlotWords = EventBus::kMaxPublisherThreads / 64;
+std::atomic<uint64_t> g_slot_bits[kSlotWords];
+
+constexpr std::size_t kNoSlot = EventBus::kMaxPublisherThreads;
+
+std::size_t claimSlot() {
+    for (std::size_t w = 0; w < kSlotWords; ++w) {
+        uint64_t bits = g_slot_bits[w].load(std::memory_order_relaxed);
+        while (~bits != 0) {
+            const int bit = __builtin_ctzll(~bits);
+            if (g_slot_bits[w].compare_exchange_weak(bits, bits | (uint64_t{1} << bit),
+                                                     std::memory_order_acq_rel)) {
+                return w * 64 + static_cast<std::size_t>(bit);
+            }
+        }
+    }
+    return kNoSlot;
+}
+
+struct ThreadSlot {
+    std::size_t index = claimSlot();
+    ~ThreadSlot() {
+        if (index != kNoSlot) {
+            g_slot_bits[index / 64].fetch_and(~(uint64_t{1} << (index % 64)), std::memory_order_release);
+        }
+    }
+};
+
+std::size_t threadSlot() {
+    static thread_local ThreadSlot slot;
+    return slot.index;
+}
+
+} // namespace
+
+uint64_t steadyClockUs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// ── Epoch-based reclamation ──────────────────────────────────────────────────
+// A publisher records the global epoch in its slot before loading a list.
+// A list replaced at epoch r is freed once every active slot shows an epoch
+// above r: those publishers loaded their list after the replacement. Slot
+// writes, list loads and list swaps are all seq_cst, so a writer that sees
+// a slot still empty knows its owner will load the new list.
+
+EventBus::ReadGuard::ReadGuard(const EventBus& bus) : bus_(bus) {
+    const std::size_t index = threadSlot();
+    if (index == kNoSlot) {
+        slot_  = nullptr;
+        outer_ = true;
+        bus_.overflow_readers_.fetch_add(1, std::memory_order_seq_cst);
+        return;
+    }
+    slot_  = &bus_.readers_[index].epoch;
+    outer_ = slot_->load(std::memory_order_relaxed) == 0;  // Not nested in another publish()
+    if (outer_) {
+        // seq_cst: the slot must be visible before the list is loaded
+        slot_->exchange(bus_.epoch_.load(std::memory_order_acquire), std::memory_order_seq_cst);
+    }
+}
+
+EventBus::ReadGuard::~ReadGuard() {
+    if (!slot_) {
+        bus_.overflow_readers_.fetch_sub(1, std::memory_order_release);
+    } else if (outer_) {
+        slot_->store(0, std::memory_order_release);
+    }
+}
+
+EventBus::EventBus() = default;
+
+EventBus::~EventBus() {
+    for (auto& list : lists_) delete list.load(std::memory_order_relaxed);
+    for (auto& retired : retired_) delete retired.second;
+}
+
+uint64_t EventBus::oldestActiveEpoch() const {
+    uint64_t oldest = UINT64_MAX;
+    for (const ReaderSlot& r : readers_) {
+        const uint64_t e = r.epoch.load(std::memory_order_seq_cst);
+        if (e != 0 && e < oldest) oldest = e;
+    }
+    return oldest;
+}
+
+void EventBus::replace(EventType type, SubscriberList* list) {
+    const SubscriberList* old =
+        lists_[static_cast<std::size_t>(type)].exchange(list, std::memory_order_seq_cst);
+    if (old) retired_.emplace_back(epoch_.fetch_add(1, std::memory_order_seq_cst), old);
+    reclaim();
+}
+
+void EventBus::reclaim() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (overflow_readers_.load(std::memory_order_seq_cst) != 0) return;
+    const uint64_t oldest = oldestActiveEpoch();
+    auto keep = std::partition(retired_.begin(), retired_.end(),
+                               [oldest](const auto& r) { return r.first >= oldest; });
+    for (auto it = keep; it != retired_.end(); ++it) delete it->second;
+    retired_.erase(keep, retired_.end());
+}
+
+void EventBus::synchronize() {
+    const uint64_t target = epoch_.load(std::memory_order_acquire);
+    // Move the epoch on so that new publishers are told apart from old ones.
+    epoch_.fetch_add(1, std::memory_order_seq_cst);
+    while (oldestActiveEpoch() <= target || overflow_readers_.load(std::memory_order_seq_cst) != 0) {
+        std::this_thread::yield();
+    }
+    // Lists retired while those publishers ran are unreachable now; without
+    // this they would wait for the next subscription change.
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    reclaim();
+}
+
+std::size_t EventBus::retiredLists() const {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    return retired_.size();
+}
+
+// ── Subscriptions ────────────────────────────────────────────────────────────
+
+void EventBus::setClock(Clock now_us) {
+    clock_ = std::move(now_us);
+}
+
+void EventBus::subscribe(EventType type, IEventSubscriber* subscriber,
+                         EventPriority priority, uint32_t deadline_us,
+                         const EventFilter& filter) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    const SubscriberList* current = lists_[static_cast<std::size_t>(type)].load(std::memory_order_relaxed);
+    auto* list = current ? new SubscriberList(*current) : new SubscriberList();
+    // After the last subscription of equal or higher priority.
+    auto pos = std::upper_bound(list->begin(), list->end(), priority,
+                                [](EventPriority p, const Subscription& s) { return p < s.priority; });
+    list->insert(pos, Subscription{subscriber, priority, deadline_us,
+                                   filter.active() ? std::make_shared<FilterSlot>(filter) : nullptr});
+    replace(type, list);
+}
+
+std::size_t EventBus::unsubscribe(EventType type, IEventSubscriber* subscriber) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    const SubscriberList* current = lists_[static_cast<std::size_t>(type)].load(std::memory_order_relaxed);
+    if (!current) return 0;
+    auto* list = new SubscriberList(*current);
+    auto  end  = std::remove_if(list->begin(), list->end(),
+                                [subscriber](const Subscription& s) { return s.subscriber == subscriber; });
+    const auto removed = static_cast<std::size_t>(list->end() - end);
+    if (removed == 0) {
+        delete list;
+        return 0;
+    }
+    list->erase(end, list->end());
+    replace(type, list);
+    return removed;
+}
+
+std::size_t EventBus::unsubscribe(IEventSubscriber* subscriber) {
+    std::size_t removed = 0;
+    for (std::size_t t = 0; t < kEventTypeCount; ++t) {
+        removed += unsubscribe(static_cast<EventType>(t), subscriber);
+    }
+    return removed;
+}
+
+std::size_t EventBus::subscriberCount(EventType type) const {
+    ReadGuard guard(*this);
+    const SubscriberList* list = lists_[static_cast<std::size_t>(type)].load(std::memory_order_seq_cst);
+    return list ? list->size() : 0;
+}
+
+uint64_t EventBus::filteredCount(IEventSubscriber* subscriber) const {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    uint64_t dropped = 0;
+    for (const auto& slot : lists_) {
+        const SubscriberList* list = slot.load(std::memory_order_relaxed);
+        if (!list) continue;
+        for (const Subscription& s : *list) {
+            if (s.subscriber == subscriber && s.filter) dropped += s.filter->dropped();
+        }
+    }
+    return dropped;
 }
 
-void EventBus::publish(EventType type, const EventData& data) {
-    auto it = subscribers_.find(type);
-    if (it == subscribers_.end()) return;
+void EventBus::resetFilters() {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    for (const auto& slot : lists_) {
+        const SubscriberList* list = slot.load(std::memory_order_relaxed);
+        if (!list) continue;
+        for (const Subscription& s : *list) {
+            if (s.filter) s.filter->reset();
+        }
+    }
+}
+
+// ── Delivery ─────────────────────────────────────────────────────────────────
+
+EventStamp& EventBus::stamp(EventData& data) const {
+    EventStamp& stamp = stampOf(data);
+    stamp.published_us = clock_();
+    if (stamp.acquired_us == 0) stamp.acquired_us = stamp.published_us;
+    return stamp;
+}
+
+void EventBus::publish(EventType type, EventData data) {
+    stamp(data);
+    deliver(type, data);
+}
+
+void EventBus::deliver(EventType type, const EventData& data) {
+    ADAS_TRACE_SCOPE_CAT("event", toString(type));
+    ReadGuard guard(*this);
+    const SubscriberList* list = lists_[static_cast<std::size_t>(type)].load(std::memory_order_seq_cst);
+    if (!list) return;
+
+    using Steady = std::chrono::steady_clock;
+    const Steady::time_point start = Steady::now();
+    const uint64_t published_us = stampOf(data).published_us;
 
-    for (IEventSubscriber* sub : it->second) {
-        sub->onEvent(type, data);
+    for (const Subscription& s : *list) {
+        if (s.filter && !s.filter->admit(type, data, published_us)) continue;
+        s.subscriber->onEvent(type, data);
+        if (s.deadline_us == 0) continue;
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            Steady::now() - start).count();
+        if (elapsed > s.deadline_us) {
+            // Already late: taking a lock here costs nobody a deadline.
+            std::lock_guard<std::mutex> lock(misses_mutex_);
+            misses_.push_back({type, s.subscriber, static_cast<uint32_t>(elapsed), s.deadline_us});
+            miss_count_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void EventBus::post(EventType type, EventData data) {
+    ReadGuard guard(*this);
+    const SubscriberList* list = lists_[static_cast<std::size_t>(type)].load(std::memory_order_seq_cst);
+    if (!list || list->empty()) return;
+    stamp(data);  // Time spent queued shows up as latency
+    // Subscriptions are sorted, so the first one is the most urgent.
+    pending_.push_back(Pending{list->front().priority, next_sequence_++, type, std::move(data)});
+    std::push_heap(pending_.begin(), pending_.end(), LaterFirst{});
+}
+
+std::size_t EventBus::dispatchPending() {
+    std::size_t delivered = 0;
+    while (!pending_.empty()) {
+        std::pop_heap(pending_.begin(), pending_.end(), LaterFirst{});
+        const Pending next = std::move(pending_.back());
+        pending_.pop_back();
+        deliver(next.type, next.data);
+        ++delivered;
     }
+    return delivered;
+}
+
+std::vector<DeadlineMiss> EventBus::takeDeadlineMisses() {
+    std::vector<DeadlineMiss> out;
+    std::lock_guard<std::mutex> lock(misses_mutex_);
+    out.swap(misses_);
+    return out;
 }
 
 } // namespace events
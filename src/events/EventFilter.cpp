@@ -0,0 +1,74 @@
+#include "adas/events/EventFilter.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <variant>
+
+namespace adas {
+namespace events {
+
+float fieldValue(const EventData& data, FilterField field) {
+    switch (field) {
+        case FilterField::RADAR_DISTANCE:
+            if (const auto* r = std::get_if<RadarData>(&data)) return r->distance_m;
+            break;
+        case FilterField::RADAR_TARGET_SPEED:
+            if (const auto* r = std::get_if<RadarData>(&data)) return r->target_speed_mps;
+            break;
+        case FilterField::RADAR_CONFIDENCE:
+            if (const auto* r = std::get_if<RadarData>(&data)) return r->confidence;
+            break;
+        case FilterField::SPEED:
+            if (const auto* s = std::get_if<SpeedData>(&data)) return s->speed_mps;
+            break;
+        case FilterField::LANE_DEVIATION:
+            if (const auto* l = std::get_if<LaneData>(&data)) return l->lateral_deviation_m;
+            break;
+        case FilterField::LANE_CONFIDENCE:
+            if (const auto* l = std::get_if<LaneData>(&data)) return l->confidence;
+            break;
+        case FilterField::DOOR_OPEN:
+            if (const auto* d = std::get_if<DoorData>(&data)) return d->is_open ? 1.0f : 0.0f;
+            break;
+    }
+    return std::numeric_limits<float>::quiet_NaN();
+}
+
+bool EventFilter::addDeadband(FilterField field, float absolute, float relative) {
+    if (deadband_count >= kMaxDeadbands) return false;
+    deadbands[deadband_count++] = Deadband{field, absolute, relative};
+    return true;
+}
+
+bool FilterSlot::admit(EventType type, const EventData& data, uint64_t now_us) {
+    if (filter_.predicate && !filter_.predicate(filter_.context, type, data)) return drop();
+
+    if (delivered_.load(std::memory_order_relaxed)) {
+        // A clock that went backwards wraps to a large gap and delivers.
+        const uint64_t gap = now_us - last_us_.load(std::memory_order_relaxed);
+        if (gap < filter_.min_interval_us) return drop();
+
+        const bool refresh = filter_.refresh_us != 0 && gap >= filter_.refresh_us;
+        if (!refresh && filter_.deadband_count > 0) {
+            bool moved = false;
+            for (std::size_t i = 0; i < filter_.deadband_count && !moved; ++i) {
+                const Deadband& band = filter_.deadbands[i];
+                const float     last = last_[i].load(std::memory_order_relaxed);
+                const float     tol  = std::max(band.absolute, band.relative * std::fabs(last));
+                // NaN (field not in this payload) counts as a change.
+                moved = !(std::fabs(fieldValue(data, band.field) - last) <= tol);
+            }
+            if (!moved) return drop();
+        }
+    }
+
+    for (std::size_t i = 0; i < filter_.deadband_count; ++i) {
+        last_[i].store(fieldValue(data, filter_.deadbands[i].field), std::memory_order_relaxed);
+    }
+    last_us_.store(now_us, std::memory_order_relaxed);
+    delivered_.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+} // namespace events
+} // namespace adas
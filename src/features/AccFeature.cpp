@@ -1,52 +1,75 @@
 #include "adas/features/AccFeature.hpp"
-#include <algorithm>
+#include "adas/features/ControlKernels.hpp"
 #include <variant>
 
 namespace adas {
 namespace features {
 
-AccFeature::AccFeature(float set_speed_mps) : set_speed_mps_(set_speed_mps) {}
+AccFeature::AccFeature(float set_speed_mps, const AccCalibration& calibration)
+    : set_speed_mps_(set_speed_mps), cal_(calibration) {}
 
 void AccFeature::onEvent(events::EventType type, const events::EventData& data) {
-    if (type == events::EventType::RADAR_UPDATE) {
-        const auto& r   = std::get<events::RadarData>(data);
-        distance_m_       = r.distance_m;
-        target_speed_mps_ = r.target_speed_mps;
-        radar_confidence_ = r.confidence;
+    if (type == events::EventType::LEAD_UPDATE) {
+        const auto& r      = std::get<events::RadarData>(data);
+        distance_m_        = r.distance_m;
+        target_speed_mps_  = r.target_speed_mps;
+        radar_confidence_  = r.confidence;
+        radar_acquired_us_ = r.stamp.acquired_us;
     } else if (type == events::EventType::SPEED_UPDATE) {
-        ego_speed_mps_ = std::get<events::SpeedData>(data).speed_mps;
-        speed_valid_   = true;
+        const auto& s      = std::get<events::SpeedData>(data);
+        ego_speed_mps_     = s.speed_mps;
+        speed_valid_       = true;
+        speed_acquired_us_ = s.stamp.acquired_us;
     }
 }
 
+void AccFeature::onSignalTimeout(events::EventType type) {
+    if (type == events::EventType::LEAD_UPDATE) radar_confidence_ = 0.0f;
+    if (type == events::EventType::SPEED_UPDATE) speed_valid_ = false;
+}
+
 void AccFeature::execute(VehicleState& state,
                           diagnostics::DTCManager& dtc,
                           uint64_t current_time_ms) {
-    if (!speed_valid_) {
+    const uint8_t speed_valid = speed_valid_ ? 1 : 0;
+    float   accel  = 0.0f;
+    uint8_t active = 0;
+    computeAccBatch({&ego_speed_mps_, &set_speed_mps_, &distance_m_, &target_speed_mps_,
+                     &radar_confidence_, &speed_valid},
+                    {&accel, &active}, 1, cal_);
+
+    if (!active) {
         dtc.report(diagnostics::DTC::ACC_SENSOR_FAULT,
                    diagnostics::Severity::WARNING,
                    "ACC: speed signal not ready", current_time_ms);
         return;
     }
+    state.ego_acceleration   = accel;
+    state.acceleration_input = olderInput({radar_acquired_us_, events::EventType::LEAD_UPDATE},
+                                          {speed_acquired_us_, events::EventType::SPEED_UPDATE});
+}
 
-    float desired_speed = set_speed_mps_;
-
-    // A vehicle is detected ahead within following range
-    if (radar_confidence_ >= kMinConfidence && distance_m_ < kFollowRange) {
-        float gap_error = distance_m_ - kMinGap;
-
-        if (gap_error < 0.0f) {
-            // Too close — slow down to match target speed
-            desired_speed = std::max(0.0f, target_speed_mps_);
-        } else {
-            // In following range — proportional approach to set speed
-            desired_speed = std::min(set_speed_mps_,
-                                     target_speed_mps_ + gap_error * 0.5f);
-        }
-    }
+void AccFeature::saveState(snapshot::SnapshotWriter& out) const {
+    out.write(set_speed_mps_);
+    out.write(ego_speed_mps_);
+    out.write(distance_m_);
+    out.write(target_speed_mps_);
+    out.write(radar_confidence_);
+    out.write(speed_valid_);
+    out.write(radar_acquired_us_);
+    out.write(speed_acquired_us_);
+}
 
-    float raw_accel = (desired_speed - ego_speed_mps_) * 0.3f;
-    state.ego_acceleration = std::clamp(raw_accel, -kMaxDecel, kMaxAccel);
+bool AccFeature::restoreState(snapshot::SnapshotReader& in) {
+    in.read(set_speed_mps_);
+    in.read(ego_speed_mps_);
+    in.read(distance_m_);
+    in.read(target_speed_mps_);
+    in.read(radar_confidence_);
+    in.read(speed_valid_);
+    in.read(radar_acquired_us_);
+    in.read(speed_acquired_us_);
+    return in.ok() && in.atEnd();
 }
 
 } // namespace features
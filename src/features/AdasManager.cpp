@@ -3,42 +3,229 @@
 #include "adas/features/AccFeature.hpp"
 #include "adas/features/LkaFeature.hpp"
 #include "adas/features/DowFeature.hpp"
+#include "adas/trace/Trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
 
 namespace adas {
 namespace features {
 
-AdasManager::AdasManager() {
-    // Create all features
-    auto aeb = std::make_unique<AebFeature>();
-    auto acc = std::make_unique<AccFeature>();
-    auto lka = std::make_unique<LkaFeature>();
-    auto dow = std::make_unique<DowFeature>();
+namespace {
+constexpr uint32_t kSnapshotMagic   = 0x504E5341;  // "ASNP"
+constexpr uint8_t  kSnapshotVersion = 4;
 
-    // Subscribe each feature to the events it needs
-    event_bus_.subscribe(events::EventType::RADAR_UPDATE, aeb.get());
-    event_bus_.subscribe(events::EventType::SPEED_UPDATE, aeb.get());
+// Dispatch deadlines (µs from publish to end of the feature's handler).
+constexpr uint32_t kAebDeadlineUs = 1000;
+constexpr uint32_t kAccDeadlineUs = 2000;
+constexpr uint32_t kLkaDeadlineUs = 5000;
+constexpr uint32_t kDowDeadlineUs = 5000;
 
-    event_bus_.subscribe(events::EventType::RADAR_UPDATE, acc.get());
-    event_bus_.subscribe(events::EventType::SPEED_UPDATE, acc.get());
+// Silence after which a sensor input counts as lost.
+constexpr uint64_t kRadarTimeoutMs = 200;
+constexpr uint64_t kSpeedTimeoutMs = 200;
+constexpr uint64_t kLaneTimeoutMs  = 300;
+} // namespace
 
-    event_bus_.subscribe(events::EventType::LANE_UPDATE,  lka.get());
+std::vector<std::unique_ptr<IAdasFeature>> makeFeatureSet(const AdasCalibration& calibration) {
+    std::vector<std::unique_ptr<IAdasFeature>> features;
+    features.push_back(std::make_unique<AebFeature>(calibration.aeb));
+    features.push_back(std::make_unique<AccFeature>(33.33f, calibration.acc));
+    features.push_back(std::make_unique<LkaFeature>(calibration.lka));
+    features.push_back(std::make_unique<DowFeature>(calibration.dow));
+    return features;
+}
+
+AdasManager::AdasManager(const AdasCalibration& calibration)
+    : tracker_([this](events::EventType type, events::EventData data) {
+          event_bus_.publish(type, std::move(data));
+      }),
+      features_(makeFeatureSet(calibration)),
+      feature_ns_(features_.size(), 0),
+      watchdog_([this](signals::SignalId id, uint64_t) {
+          timed_out_mask_ |= 1u << static_cast<unsigned>(input_types_[id]);
+      }) {
+    IAdasFeature* aeb = features_[0].get();
+    IAdasFeature* acc = features_[1].get();
+    IAdasFeature* lka = features_[2].get();
+    auto*         dow = static_cast<DowFeature*>(features_[3].get());
+
+    // Subscribe each feature to the events it needs. AEB is on the braking
+    // path and is always served first.
+    using events::EventPriority;
+    using events::EventType;
+    event_bus_.subscribe(EventType::LEAD_UPDATE,  aeb, EventPriority::CRITICAL, kAebDeadlineUs);
+    event_bus_.subscribe(EventType::SPEED_UPDATE, aeb, EventPriority::CRITICAL, kAebDeadlineUs);
+
+    event_bus_.subscribe(EventType::LEAD_UPDATE,  acc, EventPriority::HIGH, kAccDeadlineUs);
+    event_bus_.subscribe(EventType::SPEED_UPDATE, acc, EventPriority::HIGH, kAccDeadlineUs);
+
+    event_bus_.subscribe(EventType::LANE_UPDATE,  lka, EventPriority::NORMAL, kLkaDeadlineUs);
+    event_bus_.subscribe(EventType::LANE_GEOMETRY_UPDATE, lka, EventPriority::NORMAL, kLkaDeadlineUs);
+    event_bus_.subscribe(EventType::SPEED_UPDATE, lka, EventPriority::NORMAL, kLkaDeadlineUs);
 
-    event_bus_.subscribe(events::EventType::RADAR_UPDATE, dow.get());
-    event_bus_.subscribe(events::EventType::DOOR_UPDATE,  dow.get());
+    // DOW watches the rear gap, so it takes radar reports directly, but only
+    // those that would change its warning.
+    event_bus_.subscribe(EventType::RADAR_UPDATE, dow, EventPriority::NORMAL, kDowDeadlineUs,
+                         dow->radarFilter());
+    event_bus_.subscribe(EventType::DOOR_UPDATE,  dow, EventPriority::NORMAL, kDowDeadlineUs);
+
+    // Radar reports and object lists feed the braking path through the
+    // tracker's lead target.
+    event_bus_.subscribe(EventType::RADAR_UPDATE, &tracker_, EventPriority::CRITICAL);
+    event_bus_.subscribe(EventType::OBJECT_LIST_UPDATE, &tracker_, EventPriority::CRITICAL);
+    event_bus_.subscribe(EventType::SPEED_UPDATE, &tracker_, EventPriority::LOW);
+
+    // KPI inputs are observed after every feature has seen the event.
+    event_bus_.subscribe(EventType::RADAR_UPDATE, &kpis_, EventPriority::LOW);
+    event_bus_.subscribe(EventType::SPEED_UPDATE, &kpis_, EventPriority::LOW);
+
+    input_ids_.fill(kUnmonitored);
+    for (auto [type, timeout_ms] : {std::pair{EventType::RADAR_UPDATE, kRadarTimeoutMs},
+                                    std::pair{EventType::LEAD_UPDATE, kRadarTimeoutMs},
+                                    std::pair{EventType::SPEED_UPDATE, kSpeedTimeoutMs},
+                                    std::pair{EventType::LANE_UPDATE, kLaneTimeoutMs},
+                                    std::pair{EventType::LANE_GEOMETRY_UPDATE, kLaneTimeoutMs}}) {
+        input_ids_[static_cast<std::size_t>(type)] = watchdog_.add(timeout_ms);
+        input_types_.push_back(type);
+        event_bus_.subscribe(type, &input_monitor_, EventPriority::LOW);
+    }
+}
 
-    features_.push_back(std::move(aeb));
-    features_.push_back(std::move(acc));
-    features_.push_back(std::move(lka));
-    features_.push_back(std::move(dow));
+void AdasManager::InputMonitor::onEvent(events::EventType type, const events::EventData& data) {
+    // Any thread may publish; the watchdog itself is only touched in checkInputs().
+    const uint64_t         sample = events::stampOf(data).published_us / 1000 + 1;
+    std::atomic<uint64_t>& fed    = manager_.fed_ms_[static_cast<std::size_t>(type)];
+    uint64_t               newest = fed.load(std::memory_order_relaxed);
+    while (sample > newest && !fed.compare_exchange_weak(newest, sample, std::memory_order_relaxed)) {}
 }
 
-void AdasManager::publish(events::EventType type, const events::EventData& data) {
-    event_bus_.publish(type, data);
+void AdasManager::publish(events::EventType type, events::EventData data) {
+    event_bus_.publish(type, std::move(data));
+}
+
+void AdasManager::post(events::EventType type, events::EventData data) {
+    event_bus_.post(type, std::move(data));
 }
 
 void AdasManager::execute(VehicleState& state, uint64_t current_time_ms) {
-    for (auto& feature : features_) {
-        feature->execute(state, dtc_manager_, current_time_ms);
+    ADAS_TRACE_SCOPE("AdasManager::execute");
+    const auto cycle_start = std::chrono::steady_clock::now();
+    event_bus_.dispatchPending();
+    reportDeadlineMisses(current_time_ms);
+    checkInputs(current_time_ms);
+
+    for (std::size_t i = 0; i < features_.size(); ++i) {
+        IAdasFeature& feature = *features_[i];
+        feature_ns_[i]        = 0;
+        if (!load_shedder_.shouldRun(feature.criticality(state), cycle_count_)) {
+            feature.replayOutputs(state);  // Hold its last commands until it runs again
+            continue;
+        }
+        ADAS_TRACE_SCOPE_CAT("feature", feature.name());
+        const auto start = std::chrono::steady_clock::now();
+        feature.execute(state, dtc_manager_, current_time_ms);
+        feature_ns_[i] = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+    latency_.recordOutputs(state, event_bus_.now());
+    kpis_.record(state, current_time_ms);
+    if (shadow_) shadow_->endCycle(state, current_time_ms);
+    dtc_manager_.mergePosted();
+
+    const auto cycle_ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - cycle_start).count());
+    reportShedChange(load_shedder_.update(cycle_ns), cycle_ns, current_time_ms);
+    publishDiagFrame(state, current_time_ms, cycle_ns);
+
+    // Outside the measured cycle: the image is housekeeping, not control work.
+    if (checkpoint_interval_ms_ > 0 &&
+        (checkpoints_.empty() ||
+         current_time_ms >= checkpoints_.back().time_ms + checkpoint_interval_ms_)) {
+        if (checkpoints_.size() == max_checkpoints_) checkpoints_.pop_front();
+        checkpoints_.push_back({current_time_ms, saveSnapshot(kCheckpointDtcEntries)});
+    }
+    ++cycle_count_;
+}
+
+void AdasManager::publishDiagFrame(const VehicleState& state, uint64_t current_time_ms,
+                                   uint64_t cycle_ns) {
+    diagnostics::DiagFrame frame;
+    frame.cycle         = cycle_count_;
+    frame.time_ms       = current_time_ms;
+    frame.cycle_ns      = static_cast<uint32_t>(std::min<uint64_t>(cycle_ns, UINT32_MAX));
+    frame.shed_level    = static_cast<uint32_t>(load_shedder_.level());
+    frame.feature_count = static_cast<uint32_t>(std::min(features_.size(), frame.feature_ns.size()));
+    std::copy_n(feature_ns_.begin(), frame.feature_count, frame.feature_ns.begin());
+    frame.state = state;
+
+    const std::vector<diagnostics::DTCEntry>& log = dtc_manager_.entries();
+    frame.dtc_count    = static_cast<uint32_t>(log.size());
+    frame.recent_count = static_cast<uint32_t>(std::min(log.size(), frame.recent.size()));
+    for (uint32_t i = 0; i < frame.recent_count; ++i) {
+        const diagnostics::DTCEntry& e = log[log.size() - frame.recent_count + i];
+        frame.recent[i] = {static_cast<uint32_t>(e.code), static_cast<uint32_t>(e.severity), e.timestamp_ms};
+    }
+    diag_.write(frame);
+}
+
+void AdasManager::reportShedChange(int change, uint64_t cycle_ns, uint64_t current_time_ms) {
+    if (change == 0) return;
+    const std::string detail = "load shedding level " + std::to_string(load_shedder_.level()) +
+                               " (cycle " + std::to_string(cycle_ns / 1000) + "us, budget " +
+                               std::to_string(load_shedder_.config().budget_us) + "us)";
+    if (change > 0) {
+        dtc_manager_.report(diagnostics::DTC::LOAD_SHED_ACTIVE, diagnostics::Severity::WARNING,
+                            "Manager: raised " + detail, current_time_ms);
+    } else {
+        dtc_manager_.report(diagnostics::DTC::LOAD_SHED_RELEASED, diagnostics::Severity::INFO,
+                            "Manager: lowered " + detail, current_time_ms);
+    }
+}
+
+void AdasManager::checkInputs(uint64_t current_time_ms) {
+    uint32_t recovered_mask = 0;  // EventType bits
+    for (std::size_t t = 0; t < events::kEventTypeCount; ++t) {
+        const uint64_t fed = fed_ms_[t].exchange(0, std::memory_order_relaxed);
+        if (fed != 0 && watchdog_.feed(input_ids_[t], fed - 1)) recovered_mask |= 1u << t;
+    }
+    watchdog_.advance(event_bus_.now() / 1000);
+
+    for (std::size_t t = 0; t < events::kEventTypeCount; ++t) {
+        const auto     type = static_cast<events::EventType>(t);
+        const uint32_t bit  = 1u << t;
+        // Recoveries were fed before this cycle's expiries fired.
+        if (recovered_mask & bit) {
+            dtc_manager_.report(diagnostics::DTC::SIGNAL_RECOVERED, diagnostics::Severity::INFO,
+                                std::string("Manager: ") + events::toString(type) + " resumed",
+                                current_time_ms);
+        }
+        if (timed_out_mask_ & bit) {
+            dtc_manager_.report(diagnostics::DTC::SIGNAL_TIMEOUT, diagnostics::Severity::WARNING,
+                                std::string("Manager: no ") + events::toString(type) + " for " +
+                                    std::to_string(watchdog_.timeoutMs(input_ids_[t])) + "ms",
+                                current_time_ms);
+            for (const auto& feature : features_) feature->onSignalTimeout(type);
+        }
+    }
+    timed_out_mask_ = 0;
+}
+
+void AdasManager::reportDeadlineMisses(uint64_t current_time_ms) {
+    for (const events::DeadlineMiss& miss : event_bus_.takeDeadlineMisses()) {
+        const char* feature = "unknown";
+        for (const auto& f : features_) {
+            if (f.get() == miss.subscriber) feature = f->name();
+        }
+        dtc_manager_.report(diagnostics::DTC::EVENT_DEADLINE_MISSED,
+                            diagnostics::Severity::WARNING,
+                            std::string(feature) + " handled " + events::toString(miss.type) +
+                                " in " + std::to_string(miss.latency_us) + "us (deadline " +
+                                std::to_string(miss.deadline_us) + "us)",
+                            current_time_ms);
     }
 }
 
@@ -46,5 +233,164 @@ const diagnostics::DTCManager& AdasManager::dtcManager() const {
     return dtc_manager_;
 }
 
+void AdasManager::postDtc(diagnostics::DTC code, diagnostics::Severity severity,
+                          const char* message, uint64_t timestamp_ms) {
+    dtc_manager_.post(code, severity, message, timestamp_ms);
+}
+
+void AdasManager::setClock(events::EventBus::Clock now_us) {
+    event_bus_.setClock(std::move(now_us));
+}
+
+const diagnostics::LatencyTracker& AdasManager::latency() const {
+    return latency_;
+}
+
+const tracking::Tracker& AdasManager::tracker() const {
+    return tracker_;
+}
+
+const common::Seqlock<diagnostics::DiagFrame>& AdasManager::diagSnapshot() const {
+    return diag_;
+}
+
+signals::SignalStatus AdasManager::inputStatus(events::EventType type) const {
+    const signals::SignalId id = input_ids_[static_cast<std::size_t>(type)];
+    return id == kUnmonitored ? signals::SignalStatus::INITIALIZING : watchdog_.status(id);
+}
+
+const diagnostics::KpiAggregator& AdasManager::kpis() const {
+    return kpis_;
+}
+
+void AdasManager::setLoadShedding(const LoadShedConfig& config) {
+    load_shedder_ = LoadShedder(config);
+}
+
+const LoadShedder& AdasManager::loadShedder() const {
+    return load_shedder_;
+}
+
+bool AdasManager::enableShadow(std::vector<std::unique_ptr<IAdasFeature>> candidates,
+                               const ShadowConfig& config) {
+    if (shadow_) return false;
+    shadow_ = std::make_unique<ShadowRunner>(std::move(candidates), config);
+    for (events::EventType type : {events::EventType::RADAR_UPDATE, events::EventType::SPEED_UPDATE,
+                                   events::EventType::LANE_UPDATE, events::EventType::DOOR_UPDATE,
+                                   events::EventType::LANE_GEOMETRY_UPDATE,
+                                   events::EventType::OBJECT_LIST_UPDATE,
+                                   events::EventType::TRACK_UPDATE,
+                                   events::EventType::LEAD_UPDATE}) {
+        event_bus_.subscribe(type, shadow_.get(), events::EventPriority::LOW);
+    }
+    return true;
+}
+
+bool AdasManager::disableShadow() {
+    if (!shadow_) return false;
+    event_bus_.unsubscribe(shadow_.get());
+    event_bus_.synchronize();  // Publishes on other threads may still be delivering to it
+    shadow_.reset();
+    return true;
+}
+
+const ShadowRunner* AdasManager::shadow() const {
+    return shadow_.get();
+}
+
+std::vector<uint8_t> AdasManager::saveSnapshot() const {
+    return saveSnapshot(SIZE_MAX);
+}
+
+// Image layout: magic | version | feature count | (name, state block)* | tracker block | DTC block
+std::vector<uint8_t> AdasManager::saveSnapshot(std::size_t max_dtc_entries) const {
+    ADAS_TRACE_SCOPE("AdasManager::saveSnapshot");
+    snapshot::SnapshotWriter out;
+    out.write(kSnapshotMagic);
+    out.write(kSnapshotVersion);
+    out.write(static_cast<uint32_t>(features_.size()));
+    for (const auto& feature : features_) {
+        snapshot::SnapshotWriter block;
+        feature->saveState(block);
+        out.writeString(feature->name());
+        out.writeBlock(block.bytes());
+    }
+    snapshot::SnapshotWriter tracker_block;
+    tracker_.saveState(tracker_block);
+    out.writeBlock(tracker_block.bytes());
+    snapshot::SnapshotWriter dtc_block;
+    dtc_manager_.saveState(dtc_block, max_dtc_entries);
+    out.writeBlock(dtc_block.bytes());
+    return out.release();
+}
+
+bool AdasManager::restoreSnapshot(const std::vector<uint8_t>& image) {
+    snapshot::SnapshotReader in(image);
+    uint32_t magic   = 0;
+    uint8_t  version = 0;
+    uint32_t count   = 0;
+    in.read(magic);
+    in.read(version);
+    in.read(count);
+    if (!in.ok() || magic != kSnapshotMagic || version != kSnapshotVersion ||
+        count != features_.size()) {
+        return false;
+    }
+
+    // Validate the whole layout before parsing any block.
+    std::vector<snapshot::SnapshotReader> blocks;
+    blocks.reserve(count);
+    for (const auto& feature : features_) {
+        std::string name;
+        in.readString(name);
+        blocks.push_back(in.readBlock());
+        if (!in.ok() || name != feature->name()) return false;
+    }
+    snapshot::SnapshotReader tracker_block = in.readBlock();
+    snapshot::SnapshotReader dtc_block     = in.readBlock();
+    if (!in.ok() || !in.atEnd()) return false;
+
+    // Parse every block into scratch objects first: a bad block anywhere
+    // leaves the manager as it was. Readers are copied, so the same bytes
+    // then restore the live objects, which cannot fail.
+    std::vector<std::unique_ptr<IAdasFeature>> scratch = makeFeatureSet(AdasCalibration{});
+    for (std::size_t i = 0; i < features_.size(); ++i) {
+        snapshot::SnapshotReader block = blocks[i];
+        if (!scratch[i]->restoreState(block)) return false;
+    }
+    {
+        snapshot::SnapshotReader tracker_copy = tracker_block;
+        snapshot::SnapshotReader dtc_copy     = dtc_block;
+        tracking::Tracker        scratch_tracker(nullptr);
+        diagnostics::DTCManager  scratch_dtc;
+        if (!scratch_tracker.restoreState(tracker_copy) || !scratch_dtc.restoreState(dtc_copy)) {
+            return false;
+        }
+    }
+
+    for (std::size_t i = 0; i < features_.size(); ++i) features_[i]->restoreState(blocks[i]);
+    tracker_.restoreState(tracker_block);
+    dtc_manager_.restoreState(dtc_block);
+    event_bus_.resetFilters();
+    return true;
+}
+
+void AdasManager::setCheckpointInterval(uint64_t interval_ms, std::size_t max_checkpoints) {
+    checkpoint_interval_ms_ = interval_ms;
+    max_checkpoints_        = std::max<std::size_t>(max_checkpoints, 1);
+    while (checkpoints_.size() > max_checkpoints_) checkpoints_.pop_front();
+}
+
+const std::deque<Checkpoint>& AdasManager::checkpoints() const {
+    return checkpoints_;
+}
+
+const Checkpoint* AdasManager::nearestCheckpoint(uint64_t time_ms) const {
+    auto it = std::upper_bound(checkpoints_.begin(), checkpoints_.end(), time_ms,
+                               [](uint64_t t, const Checkpoint& c) { return t < c.time_ms; });
+    if (it == checkpoints_.begin()) return nullptr;
+    return &*std::prev(it);
+}
+
 } // namespace features
 } // namespace adas
@@ -1,47 +1,89 @@
 #include "adas/features/AebFeature.hpp"
+#include "adas/features/ControlKernels.hpp"
 #include <variant>
 
 namespace adas {
 namespace features {
 
+AebFeature::AebFeature(const AebCalibration& calibration) : cal_(calibration) {}
+
 void AebFeature::onEvent(events::EventType type, const events::EventData& data) {
-    if (type == events::EventType::RADAR_UPDATE) {
-        const auto& r   = std::get<events::RadarData>(data);
-        distance_m_       = r.distance_m;
-        target_speed_mps_ = r.target_speed_mps;
-        radar_confidence_ = r.confidence;
+    if (type == events::EventType::LEAD_UPDATE) {
+        const auto& r      = std::get<events::RadarData>(data);
+        distance_m_        = r.distance_m;
+        target_speed_mps_  = r.target_speed_mps;
+        radar_confidence_  = r.confidence;
+        radar_acquired_us_ = r.stamp.acquired_us;
     } else if (type == events::EventType::SPEED_UPDATE) {
-        ego_speed_mps_ = std::get<events::SpeedData>(data).speed_mps;
-        speed_valid_   = true;
+        const auto& s      = std::get<events::SpeedData>(data);
+        ego_speed_mps_     = s.speed_mps;
+        speed_valid_       = true;
+        speed_acquired_us_ = s.stamp.acquired_us;
     }
 }
 
+void AebFeature::onSignalTimeout(events::EventType type) {
+    // No lead: the target is unreliable. No speed: wait for a fresh one.
+    if (type == events::EventType::LEAD_UPDATE) radar_confidence_ = 0.0f;
+    if (type == events::EventType::SPEED_UPDATE) speed_valid_ = false;
+}
+
 void AebFeature::execute(VehicleState& state,
                           diagnostics::DTCManager& dtc,
                           uint64_t current_time_ms) {
-    // Cannot act without valid speed or low-confidence radar
-    if (!speed_valid_ || radar_confidence_ < kMinConfidence) {
-        dtc.report(diagnostics::DTC::AEB_SENSOR_FAULT,
-                   diagnostics::Severity::WARNING,
-                   "AEB: sensor not ready", current_time_ms);
-        return;
-    }
+    const uint8_t speed_valid = speed_valid_ ? 1 : 0;
+    float   intensity = 0.0f;
+    uint8_t level     = 0;
+    computeAebBatch({&distance_m_, &target_speed_mps_, &ego_speed_mps_,
+                     &radar_confidence_, &speed_valid},
+                    {&intensity, &level}, 1, cal_);
+    const InputStamp inputs = olderInput({radar_acquired_us_, events::EventType::LEAD_UPDATE},
+                                         {speed_acquired_us_, events::EventType::SPEED_UPDATE});
 
-    float closing_speed = ego_speed_mps_ - target_speed_mps_;
-    if (closing_speed <= 0.0f) return;  // target moving away or faster — no risk
+    switch (static_cast<AebLevel>(level)) {
+        case AebLevel::SENSOR_FAULT:
+            // Cannot act without valid speed or low-confidence radar
+            dtc.report(diagnostics::DTC::AEB_SENSOR_FAULT,
+                       diagnostics::Severity::WARNING,
+                       "AEB: sensor not ready", current_time_ms);
+            break;
+        case AebLevel::NONE:
+            break;
+        case AebLevel::PARTIAL:
+            state.brake_requested = true;
+            state.brake_intensity = intensity;
+            state.brake_input     = inputs;
+            break;
+        case AebLevel::FULL:
+            state.brake_requested = true;
+            state.brake_intensity = intensity;
+            state.brake_input     = inputs;
+            dtc.report(diagnostics::DTC::AEB_ACTIVATED,
+                       diagnostics::Severity::INFO,
+                       "AEB: full emergency brake", current_time_ms);
+            break;
+    }
+}
 
-    float ttc = distance_m_ / closing_speed;
+void AebFeature::saveState(snapshot::SnapshotWriter& out) const {
+    out.write(distance_m_);
+    out.write(target_speed_mps_);
+    out.write(ego_speed_mps_);
+    out.write(radar_confidence_);
+    out.write(speed_valid_);
+    out.write(radar_acquired_us_);
+    out.write(speed_acquired_us_);
+}
 
-    if (ttc < kFullBrakeTtc) {
-        state.brake_requested = true;
-        state.brake_intensity = 1.0f;
-        dtc.report(diagnostics::DTC::AEB_ACTIVATED,
-                   diagnostics::Severity::INFO,
-                   "AEB: full emergency brake", current_time_ms);
-    } else if (ttc < kPartialBrakeTtc) {
-        state.brake_requested = true;
-        state.brake_intensity = (kPartialBrakeTtc - ttc) / (kPartialBrakeTtc - kFullBrakeTtc);
-    }
+bool AebFeature::restoreState(snapshot::SnapshotReader& in) {
+    in.read(distance_m_);
+    in.read(target_speed_mps_);
+    in.read(ego_speed_mps_);
+    in.read(radar_confidence_);
+    in.read(speed_valid_);
+    in.read(radar_acquired_us_);
+    in.read(speed_acquired_us_);
+    return in.ok() && in.atEnd();
 }
 
 } // namespace features
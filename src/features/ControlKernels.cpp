@@ -0,0 +1,125 @@
+#include "adas/features/ControlKernels.hpp"
+
+namespace adas {
+namespace features {
+
+// The loops below are written for the auto-vectoriser:
+//  - arrays arrive as __restrict__ parameters (GCC ignores restrict on locals),
+//  - every load and comparison is unconditional and masks are combined with &,
+//  - masks are widened to float so all lanes have the same width,
+//  - calibration is passed by value so it is not reloaded each iteration.
+// The file is built with -fno-trapping-math so selects over divisions can be
+// if-converted; results are identical, only FP exception flags may differ.
+
+namespace {
+
+void aebKernel(const float* __restrict__ distance, const float* __restrict__ target,
+               const float* __restrict__ ego, const float* __restrict__ confidence,
+               const uint8_t* __restrict__ valid, float* __restrict__ intensity,
+               uint8_t* __restrict__ level, std::size_t n, const AebCalibration cal) {
+    const float ramp = cal.partial_brake_ttc_s - cal.full_brake_ttc_s;
+
+    for (std::size_t i = 0; i < n; ++i) {
+        // Target moving away or faster means no risk; only divide by a positive speed.
+        const float closing    = ego[i] - target[i];
+        const bool  closing_in = closing > 0.0f;
+        const float ttc        = distance[i] / (closing_in ? closing : 1.0f);
+
+        // Decision masks as 0.0f / 1.0f so they share the float lane width.
+        const bool  speed_ok  = static_cast<float>(valid[i]) > 0.0f;
+        const float sensor_ok = (speed_ok & (confidence[i] >= cal.min_confidence)) ? 1.0f : 0.0f;
+        const float braking   = ((sensor_ok > 0.0f) & closing_in &
+                                 (ttc < cal.partial_brake_ttc_s)) ? 1.0f : 0.0f;
+        const float full      = ((braking > 0.0f) & (ttc < cal.full_brake_ttc_s)) ? 1.0f : 0.0f;
+
+        const float partial_intensity = (cal.partial_brake_ttc_s - ttc) / ramp;
+        intensity[i] = (full > 0.0f) ? 1.0f : ((braking > 0.0f) ? partial_intensity : 0.0f);
+        level[i]     = static_cast<uint8_t>(sensor_ok + braking + full);  // AebLevel
+    }
+}
+
+void accKernel(const float* __restrict__ ego, const float* __restrict__ set_speed,
+               const float* __restrict__ distance, const float* __restrict__ target,
+               const float* __restrict__ confidence, const uint8_t* __restrict__ valid,
+               float* __restrict__ accel, uint8_t* __restrict__ active, std::size_t n,
+               const AccCalibration cal) {
+    for (std::size_t i = 0; i < n; ++i) {
+        // A vehicle is detected ahead within following range
+        const bool  following = (confidence[i] >= cal.min_confidence) &
+                                (distance[i] < cal.follow_range_m);
+        const float gap_error = distance[i] - cal.min_gap_m;
+
+        // Too close: match target speed. Otherwise approach set speed in proportion to the gap.
+        const float approach  = target[i] + gap_error * cal.gap_gain;
+        const float too_close = (target[i] > 0.0f) ? target[i] : 0.0f;
+        const float in_range  = (approach < set_speed[i]) ? approach : set_speed[i];
+        const float follow    = (gap_error < 0.0f) ? too_close : in_range;
+        const float desired   = following ? follow : set_speed[i];
+
+        // Clamp to [-max_decel, max_accel]
+        float cmd = (desired - ego[i]) * cal.speed_gain;
+        cmd = (cmd > cal.max_accel_mps2) ? cal.max_accel_mps2 : cmd;
+        cmd = (cmd < -cal.max_decel_mps2) ? -cal.max_decel_mps2 : cmd;
+
+        const bool speed_ok = static_cast<float>(valid[i]) > 0.0f;
+        active[i] = static_cast<uint8_t>(speed_ok);
+        accel[i]  = speed_ok ? cmd : 0.0f;
+    }
+}
+
+void lkaKernel(const float* __restrict__ deviation, const float* __restrict__ confidence,
+               float* __restrict__ steering, uint8_t* __restrict__ status, std::size_t n,
+               const LkaCalibration cal) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float dev       = deviation[i];
+        const float magnitude = (dev < 0.0f) ? -dev : dev;
+        const bool  camera_ok = confidence[i] >= cal.min_confidence;
+        const bool  acting    = camera_ok & (magnitude > cal.deviation_threshold_m);
+
+        float cmd = -dev * cal.steering_gain;
+        cmd = (cmd > cal.max_steering_rad) ? cal.max_steering_rad : cmd;
+        cmd = (cmd < -cal.max_steering_rad) ? -cal.max_steering_rad : cmd;
+
+        steering[i] = acting ? cmd : 0.0f;
+        status[i]   = static_cast<uint8_t>(camera_ok + acting);  // LkaStatus
+    }
+}
+
+void dowKernel(const float* __restrict__ distance, const float* __restrict__ target,
+               const float* __restrict__ confidence, const uint8_t* __restrict__ door,
+               uint8_t* __restrict__ level, std::size_t n, const DowCalibration cal) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const uint8_t open     = door[i] != 0;
+        const uint8_t radar_ok  = open & (confidence[i] >= cal.min_confidence);
+        const uint8_t approach  = radar_ok & (distance[i] < cal.warning_distance_m) &
+                                  (target[i] > cal.min_target_speed);
+        level[i] = static_cast<uint8_t>(open + radar_ok + approach);  // DowLevel
+    }
+}
+
+} // namespace
+
+void computeAebBatch(const AebBatchInput& in, const AebBatchOutput& out,
+                     std::size_t n, const AebCalibration& cal) {
+    aebKernel(in.distance_m, in.target_speed_mps, in.ego_speed_mps, in.radar_confidence,
+              in.speed_valid, out.brake_intensity, out.level, n, cal);
+}
+
+void computeAccBatch(const AccBatchInput& in, const AccBatchOutput& out,
+                     std::size_t n, const AccCalibration& cal) {
+    accKernel(in.ego_speed_mps, in.set_speed_mps, in.distance_m, in.target_speed_mps,
+              in.radar_confidence, in.speed_valid, out.acceleration, out.active, n, cal);
+}
+
+void computeLkaBatch(const LkaBatchInput& in, const LkaBatchOutput& out,
+                     std::size_t n, const LkaCalibration& cal) {
+    lkaKernel(in.lateral_deviation_m, in.confidence, out.steering_rad, out.status, n, cal);
+}
+
+void computeDowBatch(const DowBatchInput& in, uint8_t* level,
+                     std::size_t n, const DowCalibration& cal) {
+    dowKernel(in.distance_m, in.target_speed_mps, in.radar_confidence, in.door_open, level, n, cal);
+}
+
+} // namespace features
+} // namespace adas
@@ -1,9 +1,12 @@
 #include "adas/features/DowFeature.hpp"
+#include "adas/features/ControlKernels.hpp"
 #include <variant>
 
 namespace adas {
 namespace features {
 
+DowFeature::DowFeature(const DowCalibration& calibration) : cal_(calibration) {}
+
 void DowFeature::onEvent(events::EventType type, const events::EventData& data) {
     if (type == events::EventType::RADAR_UPDATE) {
         const auto& r   = std::get<events::RadarData>(data);
@@ -15,26 +18,66 @@ void DowFeature::onEvent(events::EventType type, const events::EventData& data)
     }
 }
 
+void DowFeature::onSignalTimeout(events::EventType type) {
+    if (type == events::EventType::RADAR_UPDATE) radar_confidence_ = 0.0f;
+}
+
+bool DowFeature::changesDecision(const events::RadarData& r) const {
+    return (r.confidence >= cal_.min_confidence) != (radar_confidence_ >= cal_.min_confidence) ||
+           (r.distance_m < cal_.warning_distance_m) != (distance_m_ < cal_.warning_distance_m) ||
+           (r.target_speed_mps > cal_.min_target_speed) != (target_speed_mps_ > cal_.min_target_speed);
+}
+
+events::EventFilter DowFeature::radarFilter() const {
+    events::EventFilter filter;
+    filter.context   = this;
+    filter.predicate = [](const void* dow, events::EventType, const events::EventData& data) {
+        return static_cast<const DowFeature*>(dow)->changesDecision(std::get<events::RadarData>(data));
+    };
+    return filter;
+}
+
 void DowFeature::execute(VehicleState& state,
                           diagnostics::DTCManager& dtc,
                           uint64_t current_time_ms) {
-    state.dow_warning = false;
-
-    if (!door_open_) return;
+    const uint8_t door  = door_open_ ? 1 : 0;
+    uint8_t       level = 0;
+    computeDowBatch({&distance_m_, &target_speed_mps_, &radar_confidence_, &door}, &level, 1, cal_);
 
-    if (radar_confidence_ < kMinConfidence) {
-        dtc.report(diagnostics::DTC::DOW_SENSOR_FAULT,
-                   diagnostics::Severity::WARNING,
-                   "DOW: radar not reliable with door open", current_time_ms);
-        return;
+    state.dow_warning = false;
+    warning_          = false;
+    switch (static_cast<DowLevel>(level)) {
+        case DowLevel::DOOR_CLOSED:
+        case DowLevel::CLEAR:
+            break;
+        case DowLevel::SENSOR_FAULT:
+            dtc.report(diagnostics::DTC::DOW_SENSOR_FAULT,
+                       diagnostics::Severity::WARNING,
+                       "DOW: radar not reliable with door open", current_time_ms);
+            break;
+        case DowLevel::WARNING:
+            state.dow_warning = true;
+            warning_          = true;
+            dtc.report(diagnostics::DTC::DOW_WARNING_ACTIVE,
+                       diagnostics::Severity::WARNING,
+                       "DOW: vehicle approaching open door", current_time_ms);
+            break;
     }
+}
 
-    if (distance_m_ < kWarningDistance && target_speed_mps_ > kMinTargetSpeed) {
-        state.dow_warning = true;
-        dtc.report(diagnostics::DTC::DOW_WARNING_ACTIVE,
-                   diagnostics::Severity::WARNING,
-                   "DOW: vehicle approaching open door", current_time_ms);
-    }
+void DowFeature::saveState(snapshot::SnapshotWriter& out) const {
+    out.write(distance_m_);
+    out.write(target_speed_mps_);
+    out.write(radar_confidence_);
+    out.write(door_open_);
+}
+
+bool DowFeature::restoreState(snapshot::SnapshotReader& in) {
+    in.read(distance_m_);
+    in.read(target_speed_mps_);
+    in.read(radar_confidence_);
+    in.read(door_open_);
+    return in.ok() && in.atEnd();
 }
 
 } // namespace features
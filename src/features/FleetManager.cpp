@@ -0,0 +1,173 @@
+#include "adas/features/FleetManager.hpp"
+#include "adas/features/ControlKernels.hpp"
+#include <string>
+#include <variant>
+
+namespace adas {
+namespace features {
+
+namespace {
+
+// One bit per DTC condition in FleetManager::faults_.
+struct FaultBit {
+    uint8_t               bit;
+    diagnostics::DTC      code;
+    diagnostics::Severity severity;
+    const char*           text;
+};
+
+constexpr FaultBit kFaults[] = {
+    {1u << 0, diagnostics::DTC::AEB_SENSOR_FAULT,   diagnostics::Severity::WARNING, "AEB: sensor not ready"},
+    {1u << 1, diagnostics::DTC::AEB_ACTIVATED,      diagnostics::Severity::INFO,    "AEB: full emergency brake"},
+    {1u << 2, diagnostics::DTC::ACC_SENSOR_FAULT,   diagnostics::Severity::WARNING, "ACC: speed signal not ready"},
+    {1u << 3, diagnostics::DTC::LKA_LOW_CONFIDENCE, diagnostics::Severity::WARNING, "LKA: camera confidence too low"},
+    {1u << 4, diagnostics::DTC::DOW_SENSOR_FAULT,   diagnostics::Severity::WARNING, "DOW: radar not reliable with door open"},
+    {1u << 5, diagnostics::DTC::DOW_WARNING_ACTIVE, diagnostics::Severity::WARNING, "DOW: vehicle approaching open door"},
+};
+
+} // namespace
+
+FleetManager::FleetManager(const AdasCalibration& calibration) : cal_(calibration) {}
+
+VehicleId FleetManager::addVehicle(float set_speed_mps) {
+    const auto id = static_cast<VehicleId>(size());
+    // Same initial state as a fresh AdasManager
+    distance_m_.push_back(999.0f);
+    target_speed_mps_.push_back(0.0f);
+    radar_confidence_.push_back(0.0f);
+    ego_speed_mps_.push_back(0.0f);
+    speed_valid_.push_back(0);
+    set_speed_mps_.push_back(set_speed_mps);
+    lateral_deviation_m_.push_back(0.0f);
+    lane_confidence_.push_back(0.0f);
+    door_open_.push_back(0);
+    radar_acquired_us_.push_back(0);
+    speed_acquired_us_.push_back(0);
+    lane_acquired_us_.push_back(0);
+
+    brake_intensity_.push_back(0.0f);
+    aeb_level_.push_back(0);
+    acceleration_.push_back(0.0f);
+    acc_active_.push_back(0);
+    steering_rad_.push_back(0.0f);
+    lka_status_.push_back(0);
+    dow_level_.push_back(0);
+    faults_.push_back(0);
+    return id;
+}
+
+void FleetManager::reserve(std::size_t vehicles) {
+    for (auto* v : {&distance_m_, &target_speed_mps_, &radar_confidence_, &ego_speed_mps_,
+                    &set_speed_mps_, &lateral_deviation_m_, &lane_confidence_,
+                    &brake_intensity_, &acceleration_, &steering_rad_}) {
+        v->reserve(vehicles);
+    }
+    for (auto* v : {&speed_valid_, &door_open_, &aeb_level_, &acc_active_, &lka_status_,
+                    &dow_level_, &faults_}) {
+        v->reserve(vehicles);
+    }
+    for (auto* v : {&radar_acquired_us_, &speed_acquired_us_, &lane_acquired_us_}) {
+        v->reserve(vehicles);
+    }
+}
+
+bool FleetManager::publish(VehicleId id, events::EventType type, const events::EventData& data) {
+    if (id >= size()) return false;
+    switch (type) {
+        case events::EventType::RADAR_UPDATE: {
+            const auto& r          = std::get<events::RadarData>(data);
+            distance_m_[id]        = r.distance_m;
+            target_speed_mps_[id]  = r.target_speed_mps;
+            radar_confidence_[id]  = r.confidence;
+            radar_acquired_us_[id] = r.stamp.acquired_us;
+            break;
+        }
+        case events::EventType::SPEED_UPDATE: {
+            const auto& s          = std::get<events::SpeedData>(data);
+            ego_speed_mps_[id]     = s.speed_mps;
+            speed_valid_[id]       = 1;
+            speed_acquired_us_[id] = s.stamp.acquired_us;
+            break;
+        }
+        case events::EventType::LANE_UPDATE: {
+            const auto& l            = std::get<events::LaneData>(data);
+            lateral_deviation_m_[id] = l.lateral_deviation_m;
+            lane_confidence_[id]     = l.confidence;
+            lane_acquired_us_[id]    = l.stamp.acquired_us;
+            break;
+        }
+        case events::EventType::DOOR_UPDATE:
+            door_open_[id] = std::get<events::DoorData>(data).is_open ? 1 : 0;
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+void FleetManager::execute(uint64_t current_time_ms) {
+    const std::size_t n = size();
+    computeAebBatch({distance_m_.data(), target_speed_mps_.data(), ego_speed_mps_.data(),
+                     radar_confidence_.data(), speed_valid_.data()},
+                    {brake_intensity_.data(), aeb_level_.data()}, n, cal_.aeb);
+    computeAccBatch({ego_speed_mps_.data(), set_speed_mps_.data(), distance_m_.data(),
+                     target_speed_mps_.data(), radar_confidence_.data(), speed_valid_.data()},
+                    {acceleration_.data(), acc_active_.data()}, n, cal_.acc);
+    computeLkaBatch({lateral_deviation_m_.data(), lane_confidence_.data()},
+                    {steering_rad_.data(), lka_status_.data()}, n, cal_.lka);
+    computeDowBatch({distance_m_.data(), target_speed_mps_.data(), radar_confidence_.data(),
+                     door_open_.data()},
+                    dow_level_.data(), n, cal_.dow);
+    reportFaults(current_time_ms);
+}
+
+void FleetManager::reportFaults(uint64_t current_time_ms) {
+    for (std::size_t i = 0; i < size(); ++i) {
+        const uint8_t now =
+            (aeb_level_[i] == static_cast<uint8_t>(AebLevel::SENSOR_FAULT)    ? kFaults[0].bit : 0) |
+            (aeb_level_[i] == static_cast<uint8_t>(AebLevel::FULL)            ? kFaults[1].bit : 0) |
+            (acc_active_[i] == 0                                              ? kFaults[2].bit : 0) |
+            (lka_status_[i] == static_cast<uint8_t>(LkaStatus::LOW_CONFIDENCE) ? kFaults[3].bit : 0) |
+            (dow_level_[i] == static_cast<uint8_t>(DowLevel::SENSOR_FAULT)    ? kFaults[4].bit : 0) |
+            (dow_level_[i] == static_cast<uint8_t>(DowLevel::WARNING)         ? kFaults[5].bit : 0);
+        const uint8_t started = now & ~faults_[i];
+        faults_[i] = now;
+        if (started == 0) continue;
+
+        for (const FaultBit& f : kFaults) {
+            if (started & f.bit) {
+                dtc_manager_.report(f.code, f.severity,
+                                    "vehicle " + std::to_string(i) + ": " + f.text, current_time_ms);
+            }
+        }
+    }
+}
+
+bool FleetManager::state(VehicleId id, VehicleState& out) const {
+    if (id >= size()) return false;
+    VehicleState s;
+    s.ego_speed_mps = ego_speed_mps_[id];
+    const InputStamp radar_and_speed =
+        olderInput({radar_acquired_us_[id], events::EventType::RADAR_UPDATE},
+                   {speed_acquired_us_[id], events::EventType::SPEED_UPDATE});
+
+    if (aeb_level_[id] >= static_cast<uint8_t>(AebLevel::PARTIAL)) {
+        s.brake_requested = true;
+        s.brake_intensity = brake_intensity_[id];
+        s.brake_input     = radar_and_speed;
+    }
+    if (acc_active_[id]) {
+        s.ego_acceleration   = acceleration_[id];
+        s.acceleration_input = radar_and_speed;
+    }
+    if (lka_status_[id] == static_cast<uint8_t>(LkaStatus::ACTIVE)) {
+        s.steering_angle_rad = steering_rad_[id];
+        s.steering_input     = {lane_acquired_us_[id], events::EventType::LANE_UPDATE};
+    }
+    s.dow_warning = dow_level_[id] == static_cast<uint8_t>(DowLevel::WARNING);
+    out = s;
+    return true;
+}
+
+} // namespace features
+} // namespace adas
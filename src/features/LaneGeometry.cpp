@@ -0,0 +1,129 @@
+#include "adas/features/LaneGeometry.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace adas {
+namespace features {
+
+bool LaneGeometry::build(const events::LanePoint* points, std::size_t count) {
+    samples_ = 0;
+    if (count < 2) return false;
+
+    float total = 0.0f;
+    for (std::size_t i = 1; i < count; ++i) {
+        total += std::hypot(points[i].x_m - points[i - 1].x_m, points[i].y_m - points[i - 1].y_m);
+    }
+    if (!(total > 0.0f)) return false;
+
+    // Walk the source segments once, emitting a sample every ds.
+    length_m_ = total;
+    ds_m_     = total / static_cast<float>(kSamples - 1);
+    std::size_t seg       = 1;
+    float       seg_start = 0.0f;  // Arc length at points[seg - 1]
+    float       seg_len   = std::hypot(points[1].x_m - points[0].x_m, points[1].y_m - points[0].y_m);
+    for (std::size_t k = 0; k < kSamples; ++k) {
+        const float s = std::min(k * ds_m_, total);
+        while (seg + 1 < count && (s > seg_start + seg_len || seg_len == 0.0f)) {
+            seg_start += seg_len;
+            ++seg;
+            seg_len = std::hypot(points[seg].x_m - points[seg - 1].x_m,
+                                 points[seg].y_m - points[seg - 1].y_m);
+        }
+        const events::LanePoint& a = points[seg - 1];
+        const events::LanePoint& b = points[seg];
+        const float t = (seg_len > 0.0f) ? std::min(std::max((s - seg_start) / seg_len, 0.0f), 1.0f) : 0.0f;
+        x_[k]       = a.x_m + (b.x_m - a.x_m) * t;
+        y_[k]       = a.y_m + (b.y_m - a.y_m) * t;
+        heading_[k] = std::atan2(b.y_m - a.y_m, b.x_m - a.x_m);
+    }
+    samples_ = static_cast<uint32_t>(kSamples);
+    return true;
+}
+
+LanePose LaneGeometry::at(float s_m) const {
+    if (!valid()) return LanePose{};
+    const float       last = static_cast<float>(samples_ - 1);
+    const float       u    = std::min(std::max(s_m / ds_m_, 0.0f), last);
+    const std::size_t i    = std::min(static_cast<std::size_t>(u), static_cast<std::size_t>(samples_ - 2));
+    const float       t    = u - static_cast<float>(i);
+
+    LanePose p;
+    p.x_m         = x_[i] + (x_[i + 1] - x_[i]) * t;
+    p.y_m         = y_[i] + (y_[i + 1] - y_[i]) * t;
+    p.heading_rad = heading_[i + (t > 0.5f ? 1 : 0)];
+
+    // Extend along the end tangent
+    const float beyond = (s_m < 0.0f) ? s_m : std::max(s_m - length_m_, 0.0f);
+    p.x_m += beyond * std::cos(p.heading_rad);
+    p.y_m += beyond * std::sin(p.heading_rad);
+    return p;
+}
+
+float LaneGeometry::nearest(float x_m, float y_m) const {
+    if (!valid()) return 0.0f;
+    // Samples are ordered by x: bracket x, then project onto the bracketing
+    // segment and its neighbours.
+    const auto        end   = x_.begin() + samples_;
+    const std::size_t hi    = static_cast<std::size_t>(std::upper_bound(x_.begin(), end, x_m) - x_.begin());
+    const std::size_t first = (hi >= 2) ? hi - 2 : 0;
+    const std::size_t last  = std::min<std::size_t>(hi + 1, samples_ - 1);
+
+    float best_s = 0.0f;
+    float best_d = std::numeric_limits<float>::infinity();
+    for (std::size_t i = first; i < last; ++i) {
+        const float ex   = x_[i + 1] - x_[i];
+        const float ey   = y_[i + 1] - y_[i];
+        const float len2 = ex * ex + ey * ey;
+        float t = (len2 > 0.0f) ? ((x_m - x_[i]) * ex + (y_m - y_[i]) * ey) / len2 : 0.0f;
+        // The end segments extend past the line, matching at()
+        if (i > 0) t = std::max(t, 0.0f);
+        if (i + 2 < samples_) t = std::min(t, 1.0f);
+        const float dx = x_[i] + ex * t - x_m;
+        const float dy = y_[i] + ey * t - y_m;
+        const float d  = dx * dx + dy * dy;
+        if (d < best_d) {
+            best_d = d;
+            best_s = (static_cast<float>(i) + t) * ds_m_;
+        }
+    }
+    return best_s;
+}
+
+float LaneGeometry::offsetOf(float x_m, float y_m, float s_m) const {
+    const LanePose c = at(s_m);
+    // Right-hand normal of the tangent (cos h, sin h) with +y to the right
+    return -(x_m - c.x_m) * std::sin(c.heading_rad) + (y_m - c.y_m) * std::cos(c.heading_rad);
+}
+
+float LaneGeometry::previewDeviation(float distance_m) const {
+    if (!valid()) return 0.0f;
+    const float s0 = nearest(0.0f, 0.0f);
+    return offsetOf(distance_m, 0.0f, s0 + distance_m);
+}
+
+void LaneGeometry::save(snapshot::SnapshotWriter& out) const {
+    out.write(samples_);
+    out.write(ds_m_);
+    out.write(length_m_);
+    out.write(x_);
+    out.write(y_);
+    out.write(heading_);
+}
+
+bool LaneGeometry::restore(snapshot::SnapshotReader& in) {
+    in.read(samples_);
+    in.read(ds_m_);
+    in.read(length_m_);
+    in.read(x_);
+    in.read(y_);
+    in.read(heading_);
+    if (samples_ > kSamples) {
+        samples_ = 0;
+        return false;
+    }
+    return in.ok();
+}
+
+} // namespace features
+} // namespace adas
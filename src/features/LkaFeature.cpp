@@ -1,34 +1,103 @@
 #include "adas/features/LkaFeature.hpp"
+#include "adas/features/ControlKernels.hpp"
 #include <algorithm>
-#include <cmath>
 #include <variant>
 
 namespace adas {
 namespace features {
 
+LkaFeature::LkaFeature(const LkaCalibration& calibration) : cal_(calibration) {}
+
 void LkaFeature::onEvent(events::EventType type, const events::EventData& data) {
     if (type == events::EventType::LANE_UPDATE) {
         const auto& l      = std::get<events::LaneData>(data);
         lateral_deviation_m_ = l.lateral_deviation_m;
         confidence_          = l.confidence;
+        lane_acquired_us_    = l.stamp.acquired_us;
+    } else if (type == events::EventType::LANE_GEOMETRY_UPDATE) {
+        const auto& g = std::get<events::LaneGeometryData>(data);
+        if (!g.lanes) return;
+        if (g.lanes->lane_count == 0) {
+            geometry_ = LaneGeometry{};  // The camera lost the lane
+            return;
+        }
+        const events::LanePolyline& lanes = *g.lanes;
+        geometry_.build(lanes.points[0].data(),
+                        std::min<std::size_t>(lanes.point_count[0], events::LanePolyline::kMaxPoints));
+        geometry_confidence_  = lanes.confidence[0];
+        geometry_acquired_us_ = g.stamp.acquired_us;
+    } else if (type == events::EventType::SPEED_UPDATE) {
+        ego_speed_mps_ = std::get<events::SpeedData>(data).speed_mps;
+    }
+}
+
+void LkaFeature::onSignalTimeout(events::EventType type) {
+    if (type == events::EventType::LANE_UPDATE) {
+        confidence_       = 0.0f;
+        lane_acquired_us_ = 0;  // Never outranks geometry that is still fresh
     }
+    // Without geometry, steer on LANE_UPDATE again.
+    if (type == events::EventType::LANE_GEOMETRY_UPDATE) geometry_ = LaneGeometry{};
 }
 
 void LkaFeature::execute(VehicleState& state,
                           diagnostics::DTCManager& dtc,
                           uint64_t current_time_ms) {
-    if (confidence_ < kMinConfidence) {
+    float      deviation  = lateral_deviation_m_;
+    float      confidence = confidence_;
+    InputStamp input{lane_acquired_us_, events::EventType::LANE_UPDATE};
+    // Steer on whichever input was acquired last
+    if (geometry_.valid() && geometry_acquired_us_ >= lane_acquired_us_) {
+        deviation  = geometry_.previewDeviation(ego_speed_mps_ * cal_.lookahead_s);
+        confidence = geometry_confidence_;
+        input      = {geometry_acquired_us_, events::EventType::LANE_GEOMETRY_UPDATE};
+    }
+
+    float   steering = 0.0f;
+    uint8_t status   = 0;
+    computeLkaBatch({&deviation, &confidence}, {&steering, &status}, 1, cal_);
+    steering_held_ = static_cast<LkaStatus>(status) == LkaStatus::ACTIVE;
+
+    if (static_cast<LkaStatus>(status) == LkaStatus::LOW_CONFIDENCE) {
         dtc.report(diagnostics::DTC::LKA_LOW_CONFIDENCE,
                    diagnostics::Severity::WARNING,
                    "LKA: camera confidence too low", current_time_ms);
         return;
     }
-
-    if (std::abs(lateral_deviation_m_) > kDeviationThreshold) {
-        float correction = -lateral_deviation_m_ * kSteeringGain;
-        state.steering_angle_rad = std::clamp(correction, -kMaxSteering, kMaxSteering);
+    if (steering_held_) {
+        held_steering_           = steering;
+        held_input_              = input;
+        state.steering_angle_rad = steering;
+        state.steering_input     = input;
     }
 }
 
+void LkaFeature::replayOutputs(VehicleState& state) const {
+    if (!steering_held_) return;
+    state.steering_angle_rad = held_steering_;
+    state.steering_input     = held_input_;
+}
+
+void LkaFeature::saveState(snapshot::SnapshotWriter& out) const {
+    out.write(lateral_deviation_m_);
+    out.write(confidence_);
+    out.write(lane_acquired_us_);
+    geometry_.save(out);
+    out.write(geometry_confidence_);
+    out.write(geometry_acquired_us_);
+    out.write(ego_speed_mps_);
+}
+
+bool LkaFeature::restoreState(snapshot::SnapshotReader& in) {
+    in.read(lateral_deviation_m_);
+    in.read(confidence_);
+    in.read(lane_acquired_us_);
+    if (!geometry_.restore(in)) return false;
+    in.read(geometry_confidence_);
+    in.read(geometry_acquired_us_);
+    in.read(ego_speed_mps_);
+    return in.ok() && in.atEnd();
+}
+
 } // namespace features
 } // namespace adas
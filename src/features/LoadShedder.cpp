@@ -0,0 +1,53 @@
+#include "adas/features/LoadShedder.hpp"
+
+namespace adas {
+namespace features {
+
+namespace {
+
+enum class Mode : uint8_t { RUN, DECIMATE, SHED };
+
+// kPolicy[level][criticality]
+constexpr Mode kPolicy[LoadShedder::kMaxLevel + 1][4] = {
+    {Mode::RUN, Mode::RUN, Mode::RUN,      Mode::RUN},
+    {Mode::RUN, Mode::RUN, Mode::RUN,      Mode::DECIMATE},
+    {Mode::RUN, Mode::RUN, Mode::DECIMATE, Mode::SHED},
+    {Mode::RUN, Mode::RUN, Mode::SHED,     Mode::SHED},
+};
+
+} // namespace
+
+int LoadShedder::update(uint64_t cycle_ns) {
+    if (config_.budget_us == 0) return 0;
+
+    const double budget_ns = config_.budget_us * 1000.0;
+    if (cycle_ns > config_.shed_ratio * budget_ns) {
+        calm_cycles_ = 0;
+        if (level_ == kMaxLevel) return 0;
+        ++level_;
+        return 1;
+    }
+
+    if (cycle_ns < config_.restore_ratio * budget_ns) {
+        if (level_ > 0 && ++calm_cycles_ >= config_.restore_cycles) {
+            calm_cycles_ = 0;
+            --level_;
+            return -1;
+        }
+    } else {
+        calm_cycles_ = 0;  // In the hysteresis band: hold
+    }
+    return 0;
+}
+
+bool LoadShedder::shouldRun(Criticality criticality, uint64_t cycle) const {
+    switch (kPolicy[level_][static_cast<uint8_t>(criticality)]) {
+        case Mode::RUN:      return true;
+        case Mode::DECIMATE: return config_.decimation <= 1 || cycle % config_.decimation == 0;
+        case Mode::SHED:     return false;
+    }
+    return true;
+}
+
+} // namespace features
+} // namespace adas
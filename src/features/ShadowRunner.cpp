@@ -0,0 +1,135 @@
+#include "adas/features/ShadowRunner.hpp"
+#include <chrono>
+#include <cmath>
+#include <utility>
+
+namespace adas {
+namespace features {
+
+namespace {
+constexpr auto kIdleSleep = std::chrono::microseconds(100);
+} // namespace
+
+ShadowRunner::ShadowRunner(std::vector<std::unique_ptr<IAdasFeature>> candidates,
+                           const ShadowConfig& config)
+    : cfg_(config),
+      candidates_(std::move(candidates)),
+      queue_(config.queue_capacity),
+      worker_([this] { run(); }) {}
+
+ShadowRunner::~ShadowRunner() {
+    stop_.store(true, std::memory_order_release);
+    worker_.join();
+}
+
+// ── Production side ──────────────────────────────────────────────────────────
+
+void ShadowRunner::onEvent(events::EventType type, const events::EventData& data) {
+    Item item;
+    item.type = type;
+    item.data = data;
+    enqueue(std::move(item));
+}
+
+void ShadowRunner::endCycle(const VehicleState& production, uint64_t current_time_ms) {
+    Item item;
+    item.cycle      = true;
+    item.production = production;
+    item.time_ms    = current_time_ms;
+    enqueue(std::move(item));
+}
+
+void ShadowRunner::enqueue(Item item) {
+    const auto start = std::chrono::steady_clock::now();
+    if (!queue_.push(std::move(item))) dropped_.fetch_add(1, std::memory_order_relaxed);
+
+    const auto ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+    total_enqueue_ns_.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t max = max_enqueue_ns_.load(std::memory_order_relaxed);
+    while (ns > max && !max_enqueue_ns_.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {}
+}
+
+ShadowStats ShadowRunner::stats() const {
+    ShadowStats s;
+    s.enqueued         = queue_.pushed();
+    s.dropped          = dropped_.load(std::memory_order_relaxed);
+    s.total_enqueue_ns = total_enqueue_ns_.load(std::memory_order_relaxed);
+    s.max_enqueue_ns   = max_enqueue_ns_.load(std::memory_order_relaxed);
+    return s;
+}
+
+void ShadowRunner::drain() const {
+    const uint64_t target = queue_.pushed();
+    while (processed_.load(std::memory_order_acquire) < target) {
+        std::this_thread::yield();
+    }
+}
+
+// ── Worker side ──────────────────────────────────────────────────────────────
+
+void ShadowRunner::run() {
+    Item item;
+    for (;;) {
+        if (!queue_.pop(item)) {
+            if (stop_.load(std::memory_order_acquire) && queue_.size() == 0) return;
+            std::this_thread::sleep_for(kIdleSleep);
+            continue;
+        }
+        if (item.cycle) {
+            runCycle(item.production, item.time_ms);
+        } else {
+            for (auto& feature : candidates_) feature->onEvent(item.type, item.data);
+        }
+        item = Item{};  // Release pooled payloads now, not at the next pop
+        processed_.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void ShadowRunner::runCycle(const VehicleState& production, uint64_t time_ms) {
+    // Same inputs as production, fresh outputs
+    VehicleState candidate;
+    candidate.ego_speed_mps       = production.ego_speed_mps;
+    candidate.target_distance_m   = production.target_distance_m;
+    candidate.target_speed_mps    = production.target_speed_mps;
+    candidate.lateral_deviation_m = production.lateral_deviation_m;
+    candidate.door_open           = production.door_open;
+    for (auto& feature : candidates_) feature->execute(candidate, dtc_, time_ms);
+    dtc_.clear();
+    compare(production, candidate, time_ms);
+    cycles_.fetch_add(1, std::memory_order_release);
+}
+
+void ShadowRunner::compare(const VehicleState& p, const VehicleState& c, uint64_t time_ms) {
+    auto flag = [](bool b) { return b ? 1.0f : 0.0f; };
+    ShadowDivergence found[5];
+    std::size_t      n = 0;
+    if (p.brake_requested != c.brake_requested) {
+        found[n++] = {time_ms, ShadowField::BRAKE_REQUESTED, flag(p.brake_requested), flag(c.brake_requested)};
+    }
+    if (std::abs(p.brake_intensity - c.brake_intensity) > cfg_.brake_tolerance) {
+        found[n++] = {time_ms, ShadowField::BRAKE_INTENSITY, p.brake_intensity, c.brake_intensity};
+    }
+    if (std::abs(p.ego_acceleration - c.ego_acceleration) > cfg_.acceleration_tolerance) {
+        found[n++] = {time_ms, ShadowField::ACCELERATION, p.ego_acceleration, c.ego_acceleration};
+    }
+    if (std::abs(p.steering_angle_rad - c.steering_angle_rad) > cfg_.steering_tolerance) {
+        found[n++] = {time_ms, ShadowField::STEERING, p.steering_angle_rad, c.steering_angle_rad};
+    }
+    if (p.dow_warning != c.dow_warning) {
+        found[n++] = {time_ms, ShadowField::DOW_WARNING, flag(p.dow_warning), flag(c.dow_warning)};
+    }
+    if (n == 0) return;
+
+    divergent_cycles_.fetch_add(1, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(log_mutex_);
+    for (std::size_t i = 0; i < n && log_.size() < cfg_.max_divergences; ++i) log_.push_back(found[i]);
+}
+
+std::vector<ShadowDivergence> ShadowRunner::divergences() const {
+    std::lock_guard<std::mutex> lock(log_mutex_);
+    return log_;
+}
+
+} // namespace features
+} // namespace adas
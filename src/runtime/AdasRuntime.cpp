@@ -0,0 +1,96 @@
+#include "adas/runtime/AdasRuntime.hpp"
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <algorithm>
+#include <cerrno>
+
+namespace adas {
+namespace runtime {
+
+namespace {
+
+constexpr int64_t kNsPerSec = 1'000'000'000;
+
+int64_t monotonicNs() {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * kNsPerSec + ts.tv_nsec;
+}
+
+void sleepUntil(int64_t deadline_ns) {
+    timespec ts{};
+    ts.tv_sec  = static_cast<time_t>(deadline_ns / kNsPerSec);
+    ts.tv_nsec = static_cast<long>(deadline_ns % kNsPerSec);
+    // Absolute deadline: retrying after a signal does not extend the sleep.
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+    }
+}
+
+} // namespace
+
+AdasRuntime::AdasRuntime(features::AdasManager& manager, const RuntimeConfig& config)
+    : manager_(manager), config_(config) {}
+
+ThreadSetup AdasRuntime::applyThreadSettings() const {
+    ThreadSetup setup;
+    if (config_.cpu >= 0 && config_.cpu < CPU_SETSIZE) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(config_.cpu, &set);
+        setup.pinned = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+    }
+    if (config_.fifo_priority > 0) {
+        sched_param param{};
+        param.sched_priority = std::min(config_.fifo_priority, sched_get_priority_max(SCHED_FIFO));
+        // Typically EPERM without CAP_SYS_NICE; the thread keeps its policy.
+        setup.fifo = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+    }
+    return setup;
+}
+
+void AdasRuntime::run(const Input& input, const Output& output, uint64_t max_cycles) {
+    stats_ = RuntimeStats{};
+
+    const int64_t period_ns = static_cast<int64_t>(config_.period_us) * 1000;
+    const int64_t start_ns  = monotonicNs() + period_ns;
+    int64_t       deadline  = start_ns;
+    int64_t       jitter_sum = 0;
+    VehicleState  state;
+
+    for (uint64_t cycle = 0; max_cycles == 0 || cycle < max_cycles; ++cycle) {
+        // Consumed, so the next run() starts afresh
+        if (stop_.exchange(false, std::memory_order_acquire)) break;
+        sleepUntil(deadline);
+        const int64_t woke   = monotonicNs();
+        const int64_t jitter = woke - deadline;
+
+        state = VehicleState{};
+        if (input) input(manager_, state, cycle);
+        manager_.execute(state, static_cast<uint64_t>((deadline - start_ns) / 1'000'000));
+        if (output) output(state, cycle);
+        const int64_t done = monotonicNs();
+
+        // Statistics
+        stats_.min_jitter_ns = (stats_.cycles == 0) ? jitter : std::min(stats_.min_jitter_ns, jitter);
+        stats_.max_jitter_ns = (stats_.cycles == 0) ? jitter : std::max(stats_.max_jitter_ns, jitter);
+        jitter_sum += jitter;
+        ++stats_.cycles;
+        stats_.mean_jitter_ns = jitter_sum / static_cast<int64_t>(stats_.cycles);
+        stats_.max_busy_ns    = std::max(stats_.max_busy_ns, static_cast<uint64_t>(done - woke));
+        stats_.jitter_us.record(static_cast<uint64_t>(jitter < 0 ? -jitter : jitter) / 1000);
+
+        deadline += period_ns;
+        if (done > deadline) {
+            // Overrun: skip the deadlines already in the past instead of
+            // running a burst of late cycles.
+            ++stats_.overruns;
+            const int64_t behind = (done - deadline) / period_ns + 1;
+            stats_.missed_periods += static_cast<uint64_t>(behind);
+            deadline += behind * period_ns;
+        }
+    }
+}
+
+} // namespace runtime
+} // namespace adas
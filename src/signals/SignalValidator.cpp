@@ -14,7 +14,20 @@ void SignalValidator::validate(Signal<float>& signal, uint64_t current_time_ms)
         signal.status = SignalStatus::TIMEOUT;
         return;
     }
+    validateValue(signal);
+}
+
+void SignalValidator::validate(Signal<float>& signal, const SignalWatchdog& watchdog,
+                               SignalId id) const {
+    const SignalStatus freshness = watchdog.status(id);
+    if (freshness != SignalStatus::VALID) {
+        signal.status = freshness;
+        return;
+    }
+    validateValue(signal);
+}
 
+void SignalValidator::validateValue(Signal<float>& signal) const {
     // Physically impossible values indicate a sensor fault
     if (signal.value < min_value_ || signal.value > max_value_) {
         signal.status = SignalStatus::OUT_OF_RANGE;
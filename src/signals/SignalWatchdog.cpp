@@ -0,0 +1,106 @@
+#include "adas/signals/SignalWatchdog.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace adas {
+namespace signals {
+
+SignalWatchdog::SignalWatchdog(ExpiryHandler on_expiry) : on_expiry_(std::move(on_expiry)) {
+    slots_.fill(kNone);
+}
+
+SignalId SignalWatchdog::add(uint64_t timeout_ms) {
+    const auto id = static_cast<SignalId>(timeout_ms_.size());
+    deadline_ms_.push_back(0);
+    timeout_ms_.push_back(static_cast<uint32_t>(std::min(std::max<uint64_t>(timeout_ms, 1), kMaxTimeoutMs)));
+    next_.push_back(kNone);
+    status_.push_back(SignalStatus::INITIALIZING);
+    return id;
+}
+
+bool SignalWatchdog::feed(SignalId id, uint64_t time_ms) {
+    // First tick at which the sample is older than the timeout, matching
+    // SignalValidator's age check.
+    const uint64_t deadline = time_ms + timeout_ms_[id] + 1;
+    if (status_[id] == SignalStatus::VALID) {
+        // Already filed; a late sample never pulls the deadline in.
+        deadline_ms_[id] = std::max(deadline_ms_[id], deadline);
+        return false;
+    }
+    // With nothing armed no tick can fire, so skip the wheel ahead rather
+    // than walk every millisecond since it was last advanced.
+    if (armed_ == 0) now_ms_ = std::max(now_ms_, time_ms);
+
+    const bool recovered = status_[id] == SignalStatus::TIMEOUT;
+    deadline_ms_[id] = deadline;
+    status_[id]      = SignalStatus::VALID;
+    ++armed_;
+    insert(id, now_ms_ + 1);  // A deadline already past fires on the next tick
+    return recovered;
+}
+
+void SignalWatchdog::insert(SignalId id, uint64_t earliest) {
+    const uint64_t deadline = std::max(deadline_ms_[id], earliest);
+    const uint64_t delta    = deadline - now_ms_;
+
+    // The lowest level whose span covers the delta. Each level's slot is
+    // cascaded down when time reaches the start of its range.
+    std::size_t level = 0;
+    while (level + 1 < kLevels && delta >= (uint64_t{1} << ((level + 1) * kSlotBits))) ++level;
+    const std::size_t slot = level * kSlots + ((deadline >> (level * kSlotBits)) & (kSlots - 1));
+
+    next_[id]    = slots_[slot];
+    slots_[slot] = id;
+}
+
+void SignalWatchdog::cascade(std::size_t level, uint64_t tick) {
+    const uint64_t index = (tick >> (level * kSlotBits)) & (kSlots - 1);
+    // Higher levels first, so their entries can land in this one.
+    if (index == 0 && level + 1 < kLevels) cascade(level + 1, tick);
+
+    uint32_t id = std::exchange(slots_[level * kSlots + index], kNone);
+    while (id != kNone) {
+        const uint32_t next = next_[id];
+        insert(id, tick);  // Still before this tick's expiries
+        id = next;
+    }
+}
+
+std::size_t SignalWatchdog::expire(uint64_t tick) {
+    std::size_t fired = 0;
+    uint32_t    id    = std::exchange(slots_[tick & (kSlots - 1)], kNone);
+    while (id != kNone) {
+        const uint32_t next = next_[id];
+        if (deadline_ms_[id] > tick) {
+            insert(id, tick + 1);  // Fed since it was filed
+        } else {
+            status_[id] = SignalStatus::TIMEOUT;
+            --armed_;
+            ++fired;
+            if (on_expiry_) on_expiry_(id, tick);
+        }
+        id = next;
+    }
+    return fired;
+}
+
+std::size_t SignalWatchdog::advance(uint64_t now_ms) {
+    std::size_t fired = 0;
+    while (now_ms_ < now_ms) {
+        if (armed_ == 0) {
+            now_ms_ = now_ms;
+            break;
+        }
+        const uint64_t tick = ++now_ms_;
+        if ((tick & (kSlots - 1)) == 0) cascade(1, tick);
+        fired += expire(tick);
+    }
+    return fired;
+}
+
+SignalStatus SignalWatchdog::status(SignalId id) const {
+    return status_[id];
+}
+
+} // namespace signals
+} // namespace adas
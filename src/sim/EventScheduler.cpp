@@ -0,0 +1,60 @@
+#include "adas/sim/EventScheduler.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace adas {
+namespace sim {
+
+EventScheduler::TaskId EventScheduler::at(uint64_t time_us, Phase phase, Action action) {
+    const auto id = static_cast<TaskId>(tasks_.size());
+    tasks_.push_back(Task{std::move(action), 0, phase, false});
+    push(std::max(time_us, now_us_), id);
+    return id;
+}
+
+EventScheduler::TaskId EventScheduler::every(uint64_t period_us, uint64_t first_us, Phase phase,
+                                             Action action) {
+    const auto id = static_cast<TaskId>(tasks_.size());
+    tasks_.push_back(Task{std::move(action), std::max<uint64_t>(period_us, 1), phase, false});
+    push(std::max(first_us, now_us_), id);
+    return id;
+}
+
+void EventScheduler::cancel(TaskId id) {
+    if (id < tasks_.size()) tasks_[id].cancelled = true;
+}
+
+void EventScheduler::push(uint64_t time_us, TaskId id) {
+    queue_.push(Entry{time_us, tasks_[id].phase, next_sequence_++, id});
+}
+
+std::size_t EventScheduler::runUntil(uint64_t end_us) {
+    const std::size_t ran = drain(end_us);
+    if (!stopped_) now_us_ = std::max(now_us_, end_us);
+    return ran;
+}
+
+std::size_t EventScheduler::run() {
+    return drain(UINT64_MAX);
+}
+
+std::size_t EventScheduler::drain(uint64_t end_us) {
+    stopped_ = false;
+    std::size_t ran = 0;
+    while (!stopped_ && !queue_.empty() && queue_.top().time_us <= end_us) {
+        const Entry next = queue_.top();
+        queue_.pop();
+        if (tasks_[next.task].cancelled) continue;
+
+        now_us_ = next.time_us;
+        Task& task = tasks_[next.task];
+        // Reschedule before running so the action may cancel itself.
+        if (task.period_us > 0) push(now_us_ + task.period_us, next.task);
+        task.action(now_us_);
+        ++ran;
+    }
+    return ran;
+}
+
+} // namespace sim
+} // namespace adas
@@ -0,0 +1,172 @@
+#include "adas/sim/ParameterSweep.hpp"
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace adas {
+namespace sim {
+
+namespace {
+
+struct ParamName {
+    SweepParam  param;
+    const char* name;
+};
+
+constexpr ParamName kParamNames[] = {
+    {SweepParam::AEB_FULL_BRAKE_TTC,    "aeb_full_brake_ttc"},
+    {SweepParam::AEB_PARTIAL_BRAKE_TTC, "aeb_partial_brake_ttc"},
+    {SweepParam::ACC_MIN_GAP,           "acc_min_gap"},
+    {SweepParam::ACC_SPEED_GAIN,        "acc_speed_gain"},
+    {SweepParam::ACC_GAP_GAIN,          "acc_gap_gain"},
+    {SweepParam::EGO_SPEED,             "ego_speed"},
+    {SweepParam::TARGET_DECEL,          "target_decel"},
+    {SweepParam::INITIAL_DISTANCE,      "initial_distance"},
+};
+
+void applyParam(SweepParam param, float value,
+                features::AdasCalibration& cal, TargetBrakingScenario& scn) {
+    switch (param) {
+        case SweepParam::AEB_FULL_BRAKE_TTC:    cal.aeb.full_brake_ttc_s    = value; break;
+        case SweepParam::AEB_PARTIAL_BRAKE_TTC: cal.aeb.partial_brake_ttc_s = value; break;
+        case SweepParam::ACC_MIN_GAP:           cal.acc.min_gap_m           = value; break;
+        case SweepParam::ACC_SPEED_GAIN:        cal.acc.speed_gain          = value; break;
+        case SweepParam::ACC_GAP_GAIN:          cal.acc.gap_gain            = value; break;
+        case SweepParam::EGO_SPEED:
+            scn.ego_speed_mps    = value;
+            scn.target_speed_mps = value;
+            break;
+        case SweepParam::TARGET_DECEL:          scn.target_decel_mps2  = value; break;
+        case SweepParam::INITIAL_DISTANCE:      scn.initial_distance_m = value; break;
+    }
+}
+
+template <typename T>
+bool writeArray(const std::filesystem::path& path, const std::vector<T>& data) {
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(data.data()),
+              static_cast<std::streamsize>(data.size() * sizeof(T)));
+    return static_cast<bool>(out);
+}
+
+} // namespace
+
+const char* toString(SweepParam param) {
+    for (const auto& p : kParamNames) {
+        if (p.param == param) return p.name;
+    }
+    return "unknown";
+}
+
+bool parseSweepParam(const std::string& text, SweepParam& param) {
+    for (const auto& p : kParamNames) {
+        if (text == p.name) {
+            param = p.param;
+            return true;
+        }
+    }
+    return false;
+}
+
+float SweepAxis::valueAt(uint32_t i) const {
+    if (steps <= 1) return min;
+    return min + (max - min) * static_cast<float>(i) / static_cast<float>(steps - 1);
+}
+
+void SweepMaps::resize(std::size_t n) {
+    activation.resize(n);
+    min_gap_m.resize(n);
+    collision.resize(n);
+}
+
+ParameterSweep::ParameterSweep(SweepConfig config) : config_(std::move(config)) {
+    for (const auto& axis : config_.axes) size_ *= std::max<uint32_t>(axis.steps, 1);
+}
+
+void ParameterSweep::pointAt(std::size_t index,
+                             features::AdasCalibration& calibration,
+                             TargetBrakingScenario& scenario) const {
+    calibration = config_.calibration;
+    scenario    = config_.scenario;
+
+    // Last axis varies fastest, so peel indices off from the back.
+    for (auto it = config_.axes.rbegin(); it != config_.axes.rend(); ++it) {
+        const uint32_t steps = std::max<uint32_t>(it->steps, 1);
+        applyParam(it->param, it->valueAt(static_cast<uint32_t>(index % steps)),
+                   calibration, scenario);
+        index /= steps;
+    }
+}
+
+void ParameterSweep::runRange(std::size_t begin, std::size_t end, SweepMaps& out,
+                              unsigned threads) const {
+    end = std::min(end, size_);
+    if (begin >= end) return;
+    out.resize(end - begin);
+
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::min<std::size_t>(threads, end - begin));
+
+    // Workers pull fixed-size chunks so slow regions of the grid (long runs
+    // with no early exit) do not leave other cores idle.
+    constexpr std::size_t kChunk = 256;
+    std::atomic<std::size_t> next{begin};
+
+    auto worker = [&]() {
+        features::AdasCalibration cal;
+        TargetBrakingScenario     scn;
+        for (;;) {
+            std::size_t first = next.fetch_add(kChunk, std::memory_order_relaxed);
+            if (first >= end) return;
+            std::size_t last = std::min(first + kChunk, end);
+            for (std::size_t i = first; i < last; ++i) {
+                pointAt(i, cal, scn);
+                ScenarioOutcome o = runTargetBraking(scn, cal);
+                out.activation[i - begin] = o.aeb_level;
+                out.min_gap_m[i - begin]  = o.min_gap_m;
+                out.collision[i - begin]  = o.collision ? 1 : 0;
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (auto& th : pool) th.join();
+}
+
+SweepMaps ParameterSweep::run(unsigned threads) const {
+    SweepMaps maps;
+    runRange(0, size_, maps, threads);
+    return maps;
+}
+
+bool ParameterSweep::writeMaps(const SweepMaps& maps, const std::string& dir) const {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    if (ec) return false;
+
+    const fs::path root(dir);
+    if (!writeArray(root / "activation.u8", maps.activation)) return false;
+    if (!writeArray(root / "min_gap.f32",   maps.min_gap_m))  return false;
+    if (!writeArray(root / "collision.u8",  maps.collision))  return false;
+
+    std::ofstream json(root / "sweep.json");
+    json << "{\n  \"points\": " << size_ << ",\n  \"layout\": \"row-major, last axis fastest\",\n"
+         << "  \"axes\": [\n";
+    for (std::size_t i = 0; i < config_.axes.size(); ++i) {
+        const auto& a = config_.axes[i];
+        json << "    {\"param\": \"" << toString(a.param) << "\", \"min\": " << a.min
+             << ", \"max\": " << a.max << ", \"steps\": " << a.steps << "}"
+             << (i + 1 < config_.axes.size() ? ",\n" : "\n");
+    }
+    json << "  ],\n  \"arrays\": {\"activation.u8\": \"uint8 AEB level (0 none, 1 partial, 2 full)\","
+         << " \"min_gap.f32\": \"float32 metres\", \"collision.u8\": \"uint8 0/1\"}\n}\n";
+    return static_cast<bool>(json);
+}
+
+} // namespace sim
+} // namespace adas
@@ -0,0 +1,58 @@
+#include "adas/sim/Scenario.hpp"
+#include <algorithm>
+#include "adas/features/AdasManager.hpp"
+#include "adas/sim/Sensors.hpp"
+#include "adas/sim/World.hpp"
+#include "adas/VehicleState.hpp"
+
+namespace adas {
+namespace sim {
+
+ScenarioOutcome runTargetBraking(const TargetBrakingScenario& scn,
+                                 const features::AdasCalibration& calibration) {
+    features::AdasManager mgr(calibration);
+    VehicleState state;
+    ScenarioOutcome outcome;
+
+    World world(static_cast<float>(scn.step_ms) / 1000.0f);
+    const ActorId ego    = world.addActor(0.0f, 0.0f, scn.ego_speed_mps);
+    const ActorId target = world.addActor(scn.initial_distance_m, 0.0f, scn.target_speed_mps);
+    EgoAdapter adapter(ego, scn.aeb_max_decel_mps2);
+    outcome.min_gap_m = scn.initial_distance_m;
+
+    uint64_t t_ms = 0;
+    mgr.setClock([&t_ms] { return t_ms * 1000; });  // Tracker and watchdog run on sim time
+    for (; t_ms <= scn.duration_ms; t_ms += scn.step_ms) {
+        if (t_ms >= scn.brake_start_ms) world.setAcceleration(target, -scn.target_decel_mps2);
+        world.step();
+
+        const float distance = world.position(target) - world.position(ego);
+        if (distance <= scn.collision_distance_m) {
+            outcome.collision = true;
+            outcome.min_gap_m = scn.collision_distance_m;
+            break;
+        }
+        outcome.min_gap_m = std::min(outcome.min_gap_m, distance);
+
+        state               = VehicleState{};
+        state.ego_speed_mps = world.speed(ego);
+        adapter.publishSensors(world, mgr);
+        mgr.execute(state, t_ms);
+        adapter.applyOutputs(world, state);
+
+        if (state.brake_requested) {
+            uint8_t level = (state.brake_intensity >= 1.0f) ? 2 : 1;
+            outcome.aeb_level = std::max(outcome.aeb_level, level);
+        }
+
+        // Both vehicles at rest: nothing further can change.
+        if (world.speed(ego) == 0.0f && world.speed(target) == 0.0f &&
+            state.ego_acceleration <= 0.0f) {
+            break;
+        }
+    }
+    return outcome;
+}
+
+} // namespace sim
+} // namespace adas
@@ -0,0 +1,64 @@
+#include "adas/sim/Sensors.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace adas {
+namespace sim {
+
+events::RadarData RadarSensor::sense(const World& world, ActorId ego) const {
+    const auto& s = world.positions();
+    const auto& d = world.lateralOffsets();
+    const auto& order     = world.byPosition();
+    const float ego_s     = s[ego];
+    const float ego_d     = d[ego];
+    const float half_lane = world.laneWidth() * 0.5f;
+
+    // Walk outwards from the ego in position order: the first actor within
+    // half a lane of the ego is the nearest, and the walk ends at the range.
+    auto inLane = [&](ActorId i) { return std::abs(d[i] - ego_d) < half_lane; };
+    auto byS    = [&s](ActorId i, float x) { return s[i] < x; };
+    ActorId hit = ego;
+    if (facing_ == Facing::FRONT) {
+        auto it = std::lower_bound(order.begin(), order.end(), ego_s, byS);
+        for (; it != order.end() && s[*it] - ego_s < range_m_; ++it) {
+            if (s[*it] > ego_s && inLane(*it)) {
+                hit = *it;
+                break;
+            }
+        }
+    } else {
+        auto it = std::lower_bound(order.begin(), order.end(), ego_s, byS);
+        for (; it != order.begin() && ego_s - s[*(it - 1)] < range_m_; --it) {
+            if (inLane(*(it - 1))) {
+                hit = *(it - 1);
+                break;
+            }
+        }
+    }
+
+    if (hit == ego) return events::RadarData{999.0f, 0.0f, confidence_};
+    return events::RadarData{std::abs(s[hit] - ego_s), world.speed(hit), confidence_};
+}
+
+events::LaneData LaneSensor::sense(const World& world, ActorId ego) const {
+    const float d = world.lateralOffset(ego);
+    return events::LaneData{d - world.laneCentre(d), confidence_};
+}
+
+void EgoAdapter::publishSensors(const World& world, features::AdasManager& mgr) const {
+    mgr.publish(events::EventType::SPEED_UPDATE, events::SpeedData{world.speed(ego_)});
+    mgr.publish(events::EventType::RADAR_UPDATE, radar.sense(world, ego_));
+    mgr.publish(events::EventType::LANE_UPDATE,  lane.sense(world, ego_));
+}
+
+void EgoAdapter::applyOutputs(World& world, const VehicleState& state) const {
+    float accel = state.ego_acceleration;
+    if (state.brake_requested) {
+        accel = std::min(accel, -state.brake_intensity * aeb_max_decel_mps2_);
+    }
+    world.setAcceleration(ego_, accel);
+    if (apply_steering) world.setSteering(ego_, state.steering_angle_rad);
+}
+
+} // namespace sim
+} // namespace adas
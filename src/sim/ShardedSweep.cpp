@@ -0,0 +1,264 @@
+#include "adas/sim/ShardedSweep.hpp"
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include "adas/snapshot/Snapshot.hpp"
+
+namespace adas {
+namespace sim {
+
+namespace {
+
+constexpr uint32_t kShardMagic   = 0x44485341;  // "ASHD"
+constexpr uint8_t  kShardVersion = 1;
+
+namespace fs = std::filesystem;
+
+bool readFile(const std::string& path, std::vector<uint8_t>& bytes) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Write to a private temporary name, then rename: readers on any host see
+// either no file or the complete one. mkstemp() makes the name unique across
+// threads, processes and hosts; the file and then its directory are synced
+// so a crash never leaves the name pointing at missing data.
+bool writeFileAtomic(const std::string& path, const std::vector<uint8_t>& bytes) {
+    std::string tmp = path + ".tmp.XXXXXX";
+    const int   fd  = ::mkstemp(tmp.data());
+    if (fd < 0) return false;
+
+    bool           ok   = ::fchmod(fd, 0644) == 0;
+    const uint8_t* data = bytes.data();
+    std::size_t    left = bytes.size();
+    while (ok && left > 0) {
+        const ssize_t n = ::write(fd, data, left);
+        if (n < 0 && errno == EINTR) continue;
+        ok = n > 0;
+        if (ok) {
+            data += n;
+            left -= static_cast<std::size_t>(n);
+        }
+    }
+    ok = ok && ::fsync(fd) == 0;
+    ok = (::close(fd) == 0) && ok;
+    if (!ok || std::rename(tmp.c_str(), path.c_str()) != 0) {
+        ::unlink(tmp.c_str());
+        return false;
+    }
+
+    const std::string dir = fs::path(path).parent_path().string();
+    const int dir_fd = ::open(dir.empty() ? "." : dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (dir_fd < 0) return false;
+    const bool synced = ::fsync(dir_fd) == 0;
+    ::close(dir_fd);
+    return synced;
+}
+
+std::string hostName() {
+    char buf[256] = {};
+    if (::gethostname(buf, sizeof(buf) - 1) != 0) return "unknown";
+    return buf;
+}
+
+// Encoded campaign identity: everything that determines shard contents.
+std::vector<uint8_t> encodeCampaign(const SweepConfig& c, std::size_t shard_points) {
+    snapshot::SnapshotWriter out;
+    out.write(kShardVersion);
+    out.write(static_cast<uint64_t>(shard_points));
+    const TargetBrakingScenario& s = c.scenario;
+    out.write(s.ego_speed_mps);
+    out.write(s.target_speed_mps);
+    out.write(s.initial_distance_m);
+    out.write(s.target_decel_mps2);
+    out.write(s.brake_start_ms);
+    out.write(s.duration_ms);
+    out.write(s.step_ms);
+    out.write(s.aeb_max_decel_mps2);
+    out.write(s.collision_distance_m);
+    out.write(c.calibration.aeb);  // all-float structs: no padding
+    out.write(c.calibration.acc);
+    out.write(c.calibration.lka);
+    out.write(c.calibration.dow);
+    out.write(static_cast<uint32_t>(c.axes.size()));
+    for (const SweepAxis& a : c.axes) {
+        out.write(static_cast<uint32_t>(a.param));
+        out.write(a.min);
+        out.write(a.max);
+        out.write(a.steps);
+    }
+    return out.release();
+}
+
+} // namespace
+
+ShardedSweep::ShardedSweep(const ParameterSweep& sweep, std::string campaign_dir,
+                           std::size_t shard_points)
+    : sweep_(sweep),
+      dir_(std::move(campaign_dir)),
+      shard_points_(std::max<std::size_t>(shard_points, 1)),
+      shard_count_((sweep.size() + shard_points_ - 1) / shard_points_) {}
+
+bool ShardedSweep::prepare() {
+    std::error_code ec;
+    fs::create_directories(fs::path(dir_) / "shards", ec);
+    if (ec) return false;
+
+    const std::string          path     = (fs::path(dir_) / "campaign.bin").string();
+    const std::vector<uint8_t> identity = encodeCampaign(sweep_.config(), shard_points_);
+    std::vector<uint8_t>       existing;
+    if (readFile(path, existing)) return existing == identity;
+    if (!writeFileAtomic(path, identity)) return false;
+    // Another coordinator may have raced us; whoever renamed last must agree.
+    return readFile(path, existing) && existing == identity;
+}
+
+std::pair<std::size_t, std::size_t> ShardedSweep::shardRange(std::size_t shard) const {
+    const std::size_t begin = shard * shard_points_;
+    return {begin, std::min(begin + shard_points_, sweep_.size())};
+}
+
+std::string ShardedSweep::shardPath(std::size_t shard, const char* suffix) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%06zu.%s", shard, suffix);
+    return (fs::path(dir_) / "shards" / name).string();
+}
+
+std::size_t ShardedSweep::recoverStaleClaims() const {
+    const std::string host    = hostName();
+    std::size_t       removed = 0;
+    for (std::size_t shard = 0; shard < shard_count_; ++shard) {
+        const std::string claim = shardPath(shard, "claim");
+        if (fs::exists(shardPath(shard, "result"))) continue;
+
+        std::ifstream in(claim);
+        std::string   owner_host;
+        long          owner_pid = 0;
+        if (!(in >> owner_host >> owner_pid) || owner_host != host) continue;
+        if (::kill(static_cast<pid_t>(owner_pid), 0) == 0 || errno != ESRCH) continue;
+
+        in.close();
+        if (std::remove(claim.c_str()) == 0) ++removed;
+    }
+    return removed;
+}
+
+std::size_t ShardedSweep::work(unsigned threads, std::size_t* failed) const {
+    const std::string owner = hostName() + " " + std::to_string(::getpid()) + "\n";
+    std::size_t done = 0;
+    std::size_t lost = 0;
+    for (std::size_t shard = 0; shard < shard_count_; ++shard) {
+        if (fs::exists(shardPath(shard, "result"))) continue;
+
+        const std::string claim = shardPath(shard, "claim");
+        const int fd = ::open(claim.c_str(), O_CREAT | O_EXCL | O_WRONLY, 0644);
+        if (fd < 0) continue;  // Someone else owns it
+        const bool wrote = ::write(fd, owner.data(), owner.size()) == static_cast<ssize_t>(owner.size());
+        ::close(fd);
+
+        if (wrote && runShard(shard, threads)) {
+            ++done;
+        } else {
+            std::remove(claim.c_str());  // Leave it for another worker
+            ++lost;
+        }
+    }
+    if (failed) *failed = lost;
+    return done;
+}
+
+// Result layout: magic | version | shard | begin | count |
+//                activation[count] | min_gap[count] | collision[count]
+bool ShardedSweep::runShard(std::size_t shard, unsigned threads) const {
+    const auto [begin, end] = shardRange(shard);
+    SweepMaps maps;
+    sweep_.runRange(begin, end, maps, threads);
+
+    snapshot::SnapshotWriter out;
+    out.write(kShardMagic);
+    out.write(kShardVersion);
+    out.write(static_cast<uint32_t>(shard));
+    out.write(static_cast<uint64_t>(begin));
+    out.write(static_cast<uint64_t>(end - begin));
+    for (uint8_t v : maps.activation) out.write(v);
+    for (float v : maps.min_gap_m) out.write(v);
+    for (uint8_t v : maps.collision) out.write(v);
+    return writeFileAtomic(shardPath(shard, "result"), out.bytes());
+}
+
+bool ShardedSweep::runLocal(unsigned processes) const {
+    std::vector<pid_t> children;
+    for (unsigned i = 0; i < std::max(processes, 1u); ++i) {
+        const pid_t pid = ::fork();
+        if (pid == 0) {
+            std::size_t failed = 0;
+            work(1, &failed);
+            ::_exit(failed == 0 ? 0 : 1);
+        }
+        if (pid < 0) break;
+        children.push_back(pid);
+    }
+
+    bool clean = !children.empty();
+    for (pid_t pid : children) {
+        int status = 0;
+        while (::waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+        }
+        clean = clean && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+    return clean;
+}
+
+std::size_t ShardedSweep::completedShards() const {
+    std::size_t n = 0;
+    for (std::size_t shard = 0; shard < shard_count_; ++shard) {
+        n += fs::exists(shardPath(shard, "result")) ? 1 : 0;
+    }
+    return n;
+}
+
+bool ShardedSweep::readShard(std::size_t shard, SweepMaps& out) const {
+    std::vector<uint8_t> bytes;
+    if (!readFile(shardPath(shard, "result"), bytes)) return false;
+
+    const auto [begin, end] = shardRange(shard);
+    snapshot::SnapshotReader in(bytes);
+    uint32_t magic = 0, index = 0;
+    uint8_t  version = 0;
+    uint64_t first = 0, count = 0;
+    in.read(magic);
+    in.read(version);
+    in.read(index);
+    in.read(first);
+    in.read(count);
+    if (!in.ok() || magic != kShardMagic || version != kShardVersion || index != shard ||
+        first != begin || count != end - begin) {
+        return false;
+    }
+    for (std::size_t i = begin; i < end; ++i) in.read(out.activation[i]);
+    for (std::size_t i = begin; i < end; ++i) in.read(out.min_gap_m[i]);
+    for (std::size_t i = begin; i < end; ++i) in.read(out.collision[i]);
+    return in.ok() && in.atEnd();
+}
+
+bool ShardedSweep::merge(SweepMaps& out) const {
+    out.resize(sweep_.size());
+    for (std::size_t shard = 0; shard < shard_count_; ++shard) {
+        if (!readShard(shard, out)) return false;
+    }
+    return true;
+}
+
+} // namespace sim
+} // namespace adas
@@ -0,0 +1,94 @@
+#include "adas/sim/World.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace adas {
+namespace sim {
+
+namespace {
+
+// Kept as a free function so the arrays are __restrict__ parameters,
+// which is what lets GCC vectorise the loop.
+void integrate(float* __restrict__ s, float* __restrict__ d, float* __restrict__ v,
+               float* __restrict__ heading, const float* __restrict__ accel,
+               const float* __restrict__ steer, std::size_t n, float dt, float inv_wheelbase) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float speed = v[i] + accel[i] * dt;
+        const float vi    = (speed > 0.0f) ? speed : 0.0f;
+        const float hi    = heading[i] + vi * steer[i] * inv_wheelbase * dt;
+        v[i]       = vi;
+        s[i]      += vi * dt;
+        heading[i] = hi;
+        d[i]      += vi * hi * dt;
+    }
+}
+
+} // namespace
+
+World::World(float step_s, float lane_width_m, float wheelbase_m)
+    : step_s_(step_s), lane_width_m_(lane_width_m), wheelbase_m_(wheelbase_m) {}
+
+ActorId World::addActor(float s_m, float d_m, float speed_mps) {
+    s_.push_back(s_m);
+    d_.push_back(d_m);
+    v_.push_back(speed_mps);
+    heading_.push_back(0.0f);
+    accel_.push_back(0.0f);
+    steer_.push_back(0.0f);
+    order_stale_ = true;
+    return static_cast<ActorId>(s_.size() - 1);
+}
+
+void World::reserve(std::size_t actors) {
+    for (auto* a : {&s_, &d_, &v_, &heading_, &accel_, &steer_}) a->reserve(actors);
+    order_.reserve(actors);
+}
+
+void World::step() {
+    integrate(s_.data(), d_.data(), v_.data(), heading_.data(), accel_.data(), steer_.data(),
+              s_.size(), step_s_, 1.0f / wheelbase_m_);
+    time_s_ += step_s_;
+    order_stale_ = true;
+}
+
+void World::advance(float duration_s) {
+    remainder_s_ += duration_s;
+    // Half-step tolerance absorbs float rounding in the accumulated remainder.
+    while (remainder_s_ >= step_s_ * 0.5f) {
+        step();
+        remainder_s_ -= step_s_;
+    }
+}
+
+void World::advanceTo(double time_s) {
+    while (time_s_ + step_s_ * 0.5 <= time_s) step();
+}
+
+const std::vector<ActorId>& World::byPosition() const {
+    if (!order_stale_) return order_;
+    order_stale_ = false;
+    auto before = [this](ActorId a, ActorId b) { return s_[a] < s_[b] || (s_[a] == s_[b] && a < b); };
+
+    if (order_.size() != s_.size()) {
+        // New actors: sort from scratch
+        order_.resize(s_.size());
+        for (std::size_t i = 0; i < order_.size(); ++i) order_[i] = static_cast<ActorId>(i);
+        std::sort(order_.begin(), order_.end(), before);
+        return order_;
+    }
+    // One step rarely reorders more than a few neighbours
+    for (std::size_t i = 1; i < order_.size(); ++i) {
+        const ActorId id = order_[i];
+        std::size_t   j  = i;
+        for (; j > 0 && before(id, order_[j - 1]); --j) order_[j] = order_[j - 1];
+        order_[j] = id;
+    }
+    return order_;
+}
+
+float World::laneCentre(float d_m) const {
+    return std::round(d_m / lane_width_m_) * lane_width_m_;
+}
+
+} // namespace sim
+} // namespace adas
@@ -0,0 +1,47 @@
+#include "adas/snapshot/Snapshot.hpp"
+
+namespace adas {
+namespace snapshot {
+
+void SnapshotWriter::writeString(const std::string& s) {
+    write(static_cast<uint32_t>(s.size()));
+    bytes_.insert(bytes_.end(), s.begin(), s.end());
+}
+
+void SnapshotWriter::writeBlock(const std::vector<uint8_t>& block) {
+    write(static_cast<uint32_t>(block.size()));
+    bytes_.insert(bytes_.end(), block.begin(), block.end());
+}
+
+bool SnapshotReader::read(bool& value) {
+    uint8_t byte = 0;
+    if (!read(byte)) return false;
+    if (byte > 1) return ok_ = false;
+    value = byte != 0;
+    return true;
+}
+
+bool SnapshotReader::readString(std::string& s) {
+    uint32_t len = 0;
+    if (!read(len)) return false;
+    if (size_ - pos_ < len) return ok_ = false;
+    s.assign(reinterpret_cast<const char*>(data_ + pos_), len);
+    pos_ += len;
+    return true;
+}
+
+SnapshotReader SnapshotReader::readBlock() {
+    uint32_t len = 0;
+    if (!read(len) || size_ - pos_ < len) {
+        ok_ = false;
+        SnapshotReader failed(nullptr, 0);
+        failed.ok_ = false;
+        return failed;
+    }
+    SnapshotReader block(data_ + pos_, len);
+    pos_ += len;
+    return block;
+}
+
+} // namespace snapshot
+} // namespace adas
@@ -0,0 +1,200 @@
+#include "adas/trace/Trace.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace adas {
+namespace trace {
+
+namespace {
+
+constexpr std::size_t kSpansPerThread = 1 << 16;
+constexpr std::size_t kFirstSpans     = 1 << 10;  // Buffers start small and double
+
+// Written only by its owning thread. count is published with release
+// ordering after the span is stored, so readers see complete spans.
+struct ThreadBuffer {
+    explicit ThreadBuffer(uint32_t id) : tid(id) {}
+
+    uint32_t                 tid;
+    std::vector<Span>        spans;
+    std::atomic<std::size_t> capacity{0};  // spans.size(), readable from any thread
+    std::atomic<std::size_t> count{0};
+    std::atomic<std::size_t> dropped{0};
+    bool                     exited = false;  // Guarded by the registry mutex
+};
+
+struct Registry {
+    std::mutex                                 mutex;  // Guards buffers
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    uint32_t                                   next_tid = 0;
+    std::atomic<bool>                          active{false};
+};
+
+Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+// Buffers are owned by the registry so spans survive their thread. On
+// exit a thread frees its buffer if empty; otherwise reset() does.
+struct BufferOwner {
+    ThreadBuffer* buffer = nullptr;
+    ~BufferOwner() {
+        if (!buffer) return;
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        if (buffer->count.load(std::memory_order_relaxed) != 0 ||
+            buffer->dropped.load(std::memory_order_relaxed) != 0) {
+            buffer->exited = true;
+            return;
+        }
+        r.buffers.erase(std::find_if(r.buffers.begin(), r.buffers.end(),
+                                     [this](const auto& b) { return b.get() == buffer; }));
+    }
+};
+
+ThreadBuffer& localBuffer() {
+    thread_local BufferOwner owner;
+    if (!owner.buffer) {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.buffers.push_back(std::make_unique<ThreadBuffer>(r.next_tid++));
+        owner.buffer = r.buffers.back().get();
+    }
+    return *owner.buffer;
+}
+
+// JSON string contents: quotes, backslashes and control characters escaped.
+void writeEscaped(std::ostream& out, const char* text) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    for (const char* c = text; *c; ++c) {
+        const auto u = static_cast<unsigned char>(*c);
+        if (*c == '"' || *c == '\\') {
+            out << '\\' << *c;
+        } else if (u < 0x20) {
+            out << "\\u00" << kHex[u >> 4] << kHex[u & 0xf];
+        } else {
+            out << *c;
+        }
+    }
+}
+
+void writeMicros(std::ostream& out, uint64_t ns) {
+    out << ns / 1000 << '.';
+    const uint64_t frac = ns % 1000;
+    out << static_cast<char>('0' + frac / 100) << static_cast<char>('0' + frac / 10 % 10)
+        << static_cast<char>('0' + frac % 10);
+}
+
+} // namespace
+
+uint64_t nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void start() { registry().active.store(true, std::memory_order_relaxed); }
+void stop()  { registry().active.store(false, std::memory_order_relaxed); }
+bool active() { return registry().active.load(std::memory_order_relaxed); }
+
+void record(const char* name, const char* category, uint64_t start_ns, uint64_t end_ns) {
+    ThreadBuffer& buf = localBuffer();
+    const std::size_t n = buf.count.load(std::memory_order_relaxed);
+    if (n == buf.spans.size()) {
+        if (n == kSpansPerThread) {
+            buf.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        buf.spans.resize(std::max(kFirstSpans, 2 * n));
+        buf.capacity.store(buf.spans.size(), std::memory_order_relaxed);
+    }
+    buf.spans[n] = Span{name, category, start_ns, end_ns - start_ns};
+    buf.count.store(n + 1, std::memory_order_release);
+}
+
+std::size_t spanCount() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    std::size_t total = 0;
+    for (const auto& b : r.buffers) total += b->count.load(std::memory_order_acquire);
+    return total;
+}
+
+std::size_t droppedCount() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    std::size_t total = 0;
+    for (const auto& b : r.buffers) total += b->dropped.load(std::memory_order_relaxed);
+    return total;
+}
+
+std::size_t bufferBytes() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    std::size_t total = 0;
+    for (const auto& b : r.buffers) total += b->capacity.load(std::memory_order_relaxed) * sizeof(Span);
+    return total;
+}
+
+// Timestamps are written relative to the earliest span, in microseconds
+// with nanosecond decimals.
+bool writeChromeJson(const std::string& path) {
+    std::ofstream out(path);
+    if (!out) return false;
+
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+
+    uint64_t origin = UINT64_MAX;
+    for (const auto& b : r.buffers) {
+        const std::size_t n = b->count.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < n; ++i) origin = std::min(origin, b->spans[i].start_ns);
+    }
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& b : r.buffers) {
+        out << (first ? "\n" : ",\n")
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << b->tid
+            << ",\"args\":{\"name\":\"thread " << b->tid << "\"}}";
+        first = false;
+
+        const std::size_t n = b->count.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < n; ++i) {
+            const Span& s = b->spans[i];
+            out << ",\n{\"name\":\"";
+            writeEscaped(out, s.name);
+            out << "\",\"cat\":\"";
+            writeEscaped(out, s.category);
+            out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << b->tid << ",\"ts\":";
+            writeMicros(out, s.start_ns - origin);
+            out << ",\"dur\":";
+            writeMicros(out, s.duration_ns);
+            out << '}';
+        }
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+void reset() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.buffers.erase(std::remove_if(r.buffers.begin(), r.buffers.end(),
+                                   [](const auto& b) { return b->exited; }),
+                    r.buffers.end());
+    for (const auto& b : r.buffers) {
+        b->spans = std::vector<Span>();  // Release the memory, not just the spans
+        b->capacity.store(0, std::memory_order_relaxed);
+        b->count.store(0, std::memory_order_relaxed);
+        b->dropped.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace trace
+} // namespace adas
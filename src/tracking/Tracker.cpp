@@ -0,0 +1,319 @@
+#include "adas/tracking/Tracker.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <variant>
+
+namespace adas {
+namespace tracking {
+
+namespace {
+constexpr float kInitialSpeedVariance = 25.0f;   // (m/s)²: a new track's velocity is a guess
+constexpr float kNoTargetDistance     = 999.0f;  // Radar "nothing in range"
+} // namespace
+
+Tracker::Tracker(Sink sink, const TrackerConfig& config)
+    : sink_(std::move(sink)), cfg_(config) {
+    cfg_.cell_m = std::max(cfg_.cell_m, cfg_.gate_m);
+    candidates_.reserve(4 * kCapacity);
+    detection_used_.reserve(events::DetectionList::kMaxDetections);
+}
+
+void Tracker::onEvent(events::EventType type, const events::EventData& data) {
+    if (type == events::EventType::OBJECT_LIST_UPDATE) {
+        const auto& list = std::get<events::ObjectListData>(data);
+        if (list.objects) update(*list.objects, list.stamp.acquired_us);
+    } else if (type == events::EventType::RADAR_UPDATE) {
+        const auto& radar = std::get<events::RadarData>(data);
+        updateRadar(radar, radar.stamp.acquired_us);
+    } else if (type == events::EventType::SPEED_UPDATE) {
+        ego_speed_mps_ = std::get<events::SpeedData>(data).speed_mps;
+    }
+}
+
+void Tracker::update(const events::DetectionList& scan, uint64_t time_us) {
+    step(scan, time_us, FieldOfView{});
+}
+
+void Tracker::updateRadar(const events::RadarData& radar, uint64_t time_us) {
+    events::DetectionList scan;
+    FieldOfView           view;
+    view.path_only = true;
+    if (radar.distance_m < kNoTargetDistance) {
+        events::Detection& d = scan.detections[scan.count++];
+        d.x_m             = radar.distance_m;
+        d.vx_mps          = radar.target_speed_mps - ego_speed_mps_;
+        d.confidence      = radar.confidence;
+        view.range_m      = radar.distance_m;  // Anything beyond is hidden behind the target
+        clear_confidence_ = 0.0f;
+    } else {
+        clear_confidence_ = radar.confidence;
+        view.range_m      = cfg_.radar_range_m;
+        view.clear        = true;
+    }
+    step(scan, time_us, view);
+}
+
+void Tracker::step(const events::DetectionList& scan, uint64_t time_us, const FieldOfView& view) {
+    const float dt_s = (has_time_ && time_us > last_time_us_) ? (time_us - last_time_us_) * 1e-6f : 0.0f;
+    // A late scan (e.g. a camera list older than the last radar report)
+    // must not wind the clock back, or the next scan predicts too far.
+    last_time_us_ = has_time_ ? std::max(last_time_us_, time_us) : time_us;
+    has_time_     = true;
+
+    predict(dt_s);
+    associate(scan, view);
+    prune();
+    publish(time_us);
+}
+
+// ── Kalman filter ────────────────────────────────────────────────────────────
+// Constant velocity per axis, state (p, v), position-only measurements. Both
+// axes share noise settings and are always updated together, so they share
+// one covariance.
+
+void Tracker::predict(float dt_s) {
+    const float q   = cfg_.accel_noise * cfg_.accel_noise;
+    const float dt2 = dt_s * dt_s;
+    for (std::size_t i = 0; i < count_; ++i) {
+        x_[i] += vx_[i] * dt_s;
+        y_[i] += vy_[i] * dt_s;
+        const float pxx = pxx_[i] + 2.0f * dt_s * pxv_[i] + dt2 * pvv_[i] + 0.25f * q * dt2 * dt2;
+        const float pxv = pxv_[i] + dt_s * pvv_[i] + 0.5f * q * dt2 * dt_s;
+        pvv_[i] += q * dt2;
+        pxx_[i] = pxx;
+        pxv_[i] = pxv;
+    }
+}
+
+void Tracker::correct(std::size_t i, const events::Detection& d) {
+    const float r  = cfg_.measurement_noise * cfg_.measurement_noise;
+    const float s  = pxx_[i] + r;
+    const float k0 = pxx_[i] / s;
+    const float k1 = pxv_[i] / s;
+
+    const float ix = d.x_m - x_[i];
+    const float iy = d.y_m - y_[i];
+    x_[i]  += k0 * ix;
+    vx_[i] += k1 * ix;
+    y_[i]  += k0 * iy;
+    vy_[i] += k1 * iy;
+
+    pvv_[i] -= k1 * pxv_[i];
+    pxv_[i] *= 1.0f - k0;
+    pxx_[i] *= 1.0f - k0;
+    confidence_[i] = d.confidence;
+}
+
+// ── Association ──────────────────────────────────────────────────────────────
+
+std::size_t Tracker::bucketOf(float x, float y, int dx, int dy) const {
+    const auto cx = static_cast<uint32_t>(static_cast<int32_t>(std::floor(x / cfg_.cell_m)) + dx);
+    const auto cy = static_cast<uint32_t>(static_cast<int32_t>(std::floor(y / cfg_.cell_m)) + dy);
+    return ((cx * 73856093u) ^ (cy * 19349663u)) & (kGridBuckets - 1);
+}
+
+bool Tracker::inPath(std::size_t i) const {
+    return x_[i] > 0.0f && std::abs(y_[i]) < cfg_.lane_half_width_m;
+}
+
+void Tracker::associate(const events::DetectionList& scan, const FieldOfView& view) {
+    const std::size_t n = std::min<std::size_t>(scan.count, events::DetectionList::kMaxDetections);
+
+    // Counting sort of tracks by grid bucket.
+    bucket_start_.fill(0);
+    for (std::size_t i = 0; i < count_; ++i) ++bucket_start_[bucketOf(x_[i], y_[i]) + 1];
+    for (std::size_t b = 0; b < kGridBuckets; ++b) bucket_start_[b + 1] += bucket_start_[b];
+    std::array<uint32_t, kGridBuckets + 1> fill = bucket_start_;
+    for (std::size_t i = 0; i < count_; ++i) {
+        by_bucket_[fill[bucketOf(x_[i], y_[i])]++] = static_cast<uint16_t>(i);
+    }
+
+    // Candidate pairs: a track within the gate is always in the 3×3 cells
+    // around a detection, because cell_m >= gate_m.
+    const float gate2 = cfg_.gate_m * cfg_.gate_m;
+    candidates_.clear();
+    for (std::size_t j = 0; j < n; ++j) {
+        const events::Detection& d = scan.detections[j];
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                const std::size_t b = bucketOf(d.x_m, d.y_m, dx, dy);
+                for (uint32_t k = bucket_start_[b]; k < bucket_start_[b + 1]; ++k) {
+                    const uint16_t t  = by_bucket_[k];
+                    const float    ex = d.x_m - x_[t];
+                    const float    ey = d.y_m - y_[t];
+                    const float    d2 = ex * ex + ey * ey;
+                    if (d2 < gate2) candidates_.push_back({d2, static_cast<uint16_t>(j), t});
+                }
+            }
+        }
+    }
+
+    // Greedy global nearest neighbour: closest pairs claim first.
+    std::sort(candidates_.begin(), candidates_.end(), [](const Candidate& a, const Candidate& b) {
+        if (a.distance2 != b.distance2) return a.distance2 < b.distance2;
+        return (a.detection != b.detection) ? a.detection < b.detection : a.track < b.track;
+    });
+    std::fill(matched_.begin(), matched_.begin() + count_, 0);
+    detection_used_.assign(n, 0);
+    for (const Candidate& c : candidates_) {
+        if (matched_[c.track] || detection_used_[c.detection]) continue;
+        matched_[c.track]            = 1;
+        detection_used_[c.detection] = 1;
+        correct(c.track, scan.detections[c.detection]);
+    }
+
+    for (std::size_t i = 0; i < count_; ++i) {
+        if (matched_[i]) {
+            hits_[i]   = static_cast<uint16_t>(std::min<int>(hits_[i] + 1, UINT16_MAX));
+            misses_[i] = 0;
+        } else if ((!view.path_only || inPath(i)) && x_[i] < view.range_m) {
+            // prune() drops a track past max_misses
+            misses_[i] = view.clear ? static_cast<uint16_t>(std::min<int>(cfg_.max_misses + 1, UINT16_MAX))
+                                    : static_cast<uint16_t>(std::min<int>(misses_[i] + 1, UINT16_MAX));
+            confidence_[i] *= cfg_.coast_confidence;
+        }
+    }
+    for (std::size_t j = 0; j < n; ++j) {
+        if (!detection_used_[j]) spawn(scan.detections[j]);
+    }
+}
+
+void Tracker::spawn(const events::Detection& d) {
+    if (count_ == kCapacity) return;
+    const std::size_t i = count_++;
+    id_[i]         = next_id_++;
+    x_[i]          = d.x_m;
+    y_[i]          = d.y_m;
+    vx_[i]         = d.vx_mps;
+    vy_[i]         = d.vy_mps;
+    pxx_[i]        = cfg_.measurement_noise * cfg_.measurement_noise;
+    pxv_[i]        = 0.0f;
+    pvv_[i]        = kInitialSpeedVariance;
+    confidence_[i] = d.confidence;
+    hits_[i]       = 1;
+    misses_[i]     = 0;
+}
+
+// Drop lost tracks by moving the last track into their slot.
+void Tracker::prune() {
+    for (std::size_t i = 0; i < count_;) {
+        if (misses_[i] <= cfg_.max_misses) {
+            ++i;
+            continue;
+        }
+        const std::size_t last = --count_;
+        id_[i]         = id_[last];
+        x_[i]          = x_[last];
+        y_[i]          = y_[last];
+        vx_[i]         = vx_[last];
+        vy_[i]         = vy_[last];
+        pxx_[i]        = pxx_[last];
+        pxv_[i]        = pxv_[last];
+        pvv_[i]        = pvv_[last];
+        confidence_[i] = confidence_[last];
+        hits_[i]       = hits_[last];
+        misses_[i]     = misses_[last];
+    }
+}
+
+// ── Output ───────────────────────────────────────────────────────────────────
+
+void Tracker::publish(uint64_t time_us) {
+    events::PooledWriter<events::TrackList> tracks = pool_.acquire();
+    if (tracks) tracks->count = 0;
+
+    // Lead: nearest confirmed track ahead within the ego's lane
+    std::size_t lead = count_;
+    for (std::size_t i = 0; i < count_; ++i) {
+        if (hits_[i] < cfg_.confirm_hits) continue;
+        if (tracks) {
+            tracks->tracks[tracks->count++] =
+                events::Track{id_[i], x_[i], y_[i], vx_[i], vy_[i], hits_[i], misses_[i]};
+        }
+        if (inPath(i) && (lead == count_ || x_[i] < x_[lead])) lead = i;
+    }
+
+    if (tracks) {
+        events::TrackListData list;
+        list.tracks            = std::move(tracks);
+        list.stamp.acquired_us = time_us;
+        sink_(events::EventType::TRACK_UPDATE, std::move(list));
+    } else {
+        ++dropped_lists_;
+    }
+
+    // No confirmed lead is only a confident "no target" on the radar's word.
+    events::RadarData lead_data{kNoTargetDistance, 0.0f, clear_confidence_};
+    if (lead < count_) {
+        lead_data = {x_[lead], std::max(ego_speed_mps_ + vx_[lead], 0.0f), confidence_[lead]};
+    }
+    lead_data.stamp.acquired_us = time_us;
+    sink_(events::EventType::LEAD_UPDATE, lead_data);
+}
+
+// ── Checkpoint ───────────────────────────────────────────────────────────────
+
+namespace {
+struct SavedTrack {
+    uint32_t id;
+    float    x, vx, y, vy, pxx, pxv, pvv, confidence;
+    uint16_t hits, misses;
+};
+} // namespace
+
+void Tracker::saveState(snapshot::SnapshotWriter& out) const {
+    out.write(static_cast<uint32_t>(count_));
+    for (std::size_t i = 0; i < count_; ++i) {
+        out.write(SavedTrack{id_[i], x_[i], vx_[i], y_[i], vy_[i], pxx_[i], pxv_[i], pvv_[i],
+                             confidence_[i], hits_[i], misses_[i]});
+    }
+    out.write(next_id_);
+    out.write(last_time_us_);
+    out.write(has_time_);
+    out.write(ego_speed_mps_);
+    out.write(clear_confidence_);
+}
+
+bool Tracker::restoreState(snapshot::SnapshotReader& in) {
+    uint32_t count = 0;
+    if (!in.read(count) || count > kCapacity) return false;
+    std::vector<SavedTrack> tracks(count);
+    for (SavedTrack& t : tracks) in.read(t);
+    uint32_t next_id          = 0;
+    uint64_t last_time_us     = 0;
+    bool     has_time         = false;
+    float    ego_speed_mps    = 0.0f;
+    float    clear_confidence = 0.0f;
+    in.read(next_id);
+    in.read(last_time_us);
+    in.read(has_time);
+    in.read(ego_speed_mps);
+    in.read(clear_confidence);
+    if (!in.ok() || !in.atEnd()) return false;
+
+    count_ = count;
+    for (std::size_t i = 0; i < count_; ++i) {
+        const SavedTrack& t = tracks[i];
+        id_[i]         = t.id;
+        x_[i]          = t.x;
+        vx_[i]         = t.vx;
+        y_[i]          = t.y;
+        vy_[i]         = t.vy;
+        pxx_[i]        = t.pxx;
+        pxv_[i]        = t.pxv;
+        pvv_[i]        = t.pvv;
+        confidence_[i] = t.confidence;
+        hits_[i]       = t.hits;
+        misses_[i]     = t.misses;
+    }
+    next_id_          = next_id;
+    last_time_us_     = last_time_us;
+    has_time_         = has_time;
+    ego_speed_mps_    = ego_speed_mps;
+    clear_confidence_ = clear_confidence;
+    return true;
+}
+
+} // namespace tracking
+} // namespace adas
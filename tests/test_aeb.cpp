@@ -11,7 +11,7 @@ TEST(AebFeature, FullBrakeOnCriticalTTC) {
     AebFeature aeb;
     // ego 30 m/s, target stopped, distance 30m → TTC = 1.0s < 1.5s
     aeb.onEvent(EventType::SPEED_UPDATE,  SpeedData{30.0f});
-    aeb.onEvent(EventType::RADAR_UPDATE,  RadarData{30.0f, 0.0f, 0.9f});
+    aeb.onEvent(EventType::LEAD_UPDATE,   RadarData{30.0f, 0.0f, 0.9f});
     adas::VehicleState state;
     DTCManager dtc;
     aeb.execute(state, dtc, 0);
@@ -23,7 +23,7 @@ TEST(AebFeature, PartialBrakeOnWarningTTC) {
     AebFeature aeb;
     // ego 30 m/s, target stopped, distance 60m → TTC = 2.0s  (1.5 < 2.0 < 3.0)
     aeb.onEvent(EventType::SPEED_UPDATE,  SpeedData{30.0f});
-    aeb.onEvent(EventType::RADAR_UPDATE,  RadarData{60.0f, 0.0f, 0.9f});
+    aeb.onEvent(EventType::LEAD_UPDATE,   RadarData{60.0f, 0.0f, 0.9f});
     adas::VehicleState state;
     DTCManager dtc;
     aeb.execute(state, dtc, 0);
@@ -36,7 +36,7 @@ TEST(AebFeature, NoBrakeWhenClear) {
     AebFeature aeb;
     // ego 30 m/s, target also 30 m/s (same speed) — closing speed = 0
     aeb.onEvent(EventType::SPEED_UPDATE,  SpeedData{30.0f});
-    aeb.onEvent(EventType::RADAR_UPDATE,  RadarData{50.0f, 30.0f, 0.9f});
+    aeb.onEvent(EventType::LEAD_UPDATE,   RadarData{50.0f, 30.0f, 0.9f});
     adas::VehicleState state;
     DTCManager dtc;
     aeb.execute(state, dtc, 0);
@@ -46,7 +46,7 @@ TEST(AebFeature, NoBrakeWhenClear) {
 TEST(AebFeature, NoBrakeOnLowConfidence) {
     AebFeature aeb;
     aeb.onEvent(EventType::SPEED_UPDATE,  SpeedData{30.0f});
-    aeb.onEvent(EventType::RADAR_UPDATE,  RadarData{20.0f, 0.0f, 0.2f});  // low confidence
+    aeb.onEvent(EventType::LEAD_UPDATE,   RadarData{20.0f, 0.0f, 0.2f});  // low confidence
     adas::VehicleState state;
     DTCManager dtc;
     aeb.execute(state, dtc, 0);
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+#include <variant>
+#include "adas/can/ActuatorEncoder.hpp"
+#include "adas/can/CanDecoder.hpp"
+
+using namespace adas;
+using namespace adas::can;
+using namespace adas::events;
+
+TEST(CanSignal, ExtractsIntelMotorolaAndSigned) {
+    CanFrame f;
+    f.data[0] = 0x12;
+    f.data[1] = 0x34;
+    f.data[2] = 0xFE;  // 0xFFFE little endian = -2 signed
+
+    EXPECT_FLOAT_EQ(extract(compile({0, 16, ByteOrder::INTEL, false, 1.0f, 0.0f}), f.data.data()), 0x3412);
+    EXPECT_FLOAT_EQ(extract(compile({7, 16, ByteOrder::MOTOROLA, false, 1.0f, 0.0f}), f.data.data()), 0x1234);
+    f.data[3] = 0xFF;
+    EXPECT_FLOAT_EQ(extract(compile({16, 16, ByteOrder::INTEL, true, 0.5f, 1.0f}), f.data.data()), 0.0f);
+    EXPECT_FLOAT_EQ(extract(compile({12, 4, ByteOrder::INTEL, false, 1.0f, 0.0f}), f.data.data()), 0x3);
+
+    // insert() round-trips and leaves neighbouring bits alone.
+    const CompiledSignal speed = compile({7, 16, ByteOrder::MOTOROLA, false, 0.01f, 0.0f});
+    insert(speed, 27.5f, f.data.data());
+    EXPECT_NEAR(extract(speed, f.data.data()), 27.5f, 0.005f);
+    EXPECT_EQ(f.data[2], 0xFE);
+}
+
+TEST(CanDecoder, DecodesAdasFramesWithReceiveStamp) {
+    CanFrame f;
+    ASSERT_TRUE(parseCandumpLine("(1697040000.250000) can0 120#D007F6FFE1", f));
+    EXPECT_EQ(f.time_us, 1697040000250000u);
+
+    const CanDecoder decoder;
+    EventType type;
+    EventData data;
+    ASSERT_TRUE(decoder.decode(f, type, data));
+    EXPECT_EQ(type, EventType::RADAR_UPDATE);
+    const auto& radar = std::get<RadarData>(data);
+    EXPECT_NEAR(radar.distance_m, 40.0f, 1e-3f);         // 0x07D0 * 0.02
+    EXPECT_NEAR(radar.target_speed_mps, -0.10f, 1e-4f);  // 0xFFF6 signed * 0.01
+    EXPECT_NEAR(radar.confidence, 0.9f, 1e-4f);          // 0xE1 * 0.004
+    EXPECT_EQ(radar.stamp.acquired_us, f.time_us);
+
+    ASSERT_TRUE(parseCandumpLine("(0.000001) can0 150#01", f));
+    ASSERT_TRUE(decoder.decode(f, type, data));
+    EXPECT_TRUE(std::get<DoorData>(data).is_open);
+
+    ASSERT_TRUE(parseCandumpLine("(0.000002) can0 7FF#00", f));
+    EXPECT_FALSE(decoder.decode(f, type, data));  // Unknown id
+    ASSERT_TRUE(parseCandumpLine("(0.000003) can0 130#0B", f));
+    EXPECT_FALSE(decoder.decode(f, type, data));  // Too short for speed
+
+    // 8 hex digits is an extended id, even one that fits 11 bits; it must
+    // never decode as the radar frame 0x120
+    ASSERT_TRUE(parseCandumpLine("(0.000004) can0 00000120#D007F6FFE1", f));
+    EXPECT_EQ(f.id, 0x120u);
+    EXPECT_TRUE(f.extended);
+    EXPECT_FALSE(decoder.decode(f, type, data));
+    ASSERT_TRUE(parseCandumpLine("(0.000004) can0 1FFFFFFF#01", f));
+    EXPECT_TRUE(f.extended);
+    EXPECT_FALSE(parseCandumpLine("(0.000004) can0 20000000#01", f));  // Over 29 bits
+    ASSERT_TRUE(parseCandumpLine("(0.000004) can0 120#D007F6FFE1", f));
+    EXPECT_FALSE(f.extended);
+
+    // Ids are at most 8 hex digits; a longer one must not wrap to 0x120
+    EXPECT_FALSE(parseCandumpLine("(0.000005) can0 100000120#01", f));
+    EXPECT_FALSE(parseCandumpLine("(0.000006) can0 10000000000000120#01", f));
+}
+
+TEST(CandumpReader, ReadsClassicAndFdAndSkipsGarbage) {
+    std::istringstream log("(1.000000) can0 130#0BB8\n"
+                           "not a frame\n"
+                           "\n"
+                           "(1.010000) can1 140##1E8030000E1\n"
+                           "(1.020000) can0 130#R\n");
+    CandumpReader reader(log);
+    CanFrame f;
+    ASSERT_TRUE(reader.next(f));
+    EXPECT_EQ(f.id, 0x130u);
+    EXPECT_EQ(f.length, 2);
+    ASSERT_TRUE(reader.next(f));
+    EXPECT_TRUE(f.fd);
+    EXPECT_EQ(f.length, 5);
+    EXPECT_EQ(f.time_us, 1010000u);
+    EXPECT_FALSE(reader.next(f));
+    EXPECT_EQ(reader.skippedLines(), 2u);  // Garbage and the remote frame
+
+    features::AdasManager mgr;
+    const CanDecoder decoder;
+    ASSERT_TRUE(parseCandumpLine("(1.000000) can0 130#0BB8", f));
+    EXPECT_TRUE(decoder.feed(f, mgr));  // 30.00 m/s
+}
+
+TEST(ActuatorEncoder, SendsOnlyChangedRequestsAndRefreshes) {
+    std::vector<CanFrame> sent;
+    ActuatorEncoder enc([&sent](const CanFrame& f) { sent.push_back(f); });
+
+    VehicleState s;
+    s.brake_requested    = true;
+    s.brake_intensity    = 0.5f;
+    s.steering_angle_rad = -0.1f;
+    EXPECT_EQ(enc.update(s, 0), 4u);  // Everything goes out once
+    EXPECT_EQ(sent[0].id, 0x200u);
+    EXPECT_EQ(sent[0].length, 3u);
+    EXPECT_NEAR(extract(compile({8, 16, ByteOrder::INTEL, false, 0.0001f, 0.0f}), sent[0].data.data()), 0.5f, 1e-4f);
+    EXPECT_NEAR(extract(compile({0, 16, ByteOrder::INTEL, true, 0.0001f, 0.0f}), sent[2].data.data()), -0.1f, 1e-4f);
+
+    // Inside every deadband: nothing
+    s.brake_intensity    = 0.505f;
+    s.steering_angle_rad = -0.101f;
+    EXPECT_EQ(enc.update(s, 10'000), 0u);
+
+    // Steering moves, then the brake is released
+    s.steering_angle_rad = -0.11f;
+    EXPECT_EQ(enc.update(s, 20'000), 1u);
+    EXPECT_EQ(sent.back().id, 0x202u);
+    s.brake_requested = false;
+    EXPECT_EQ(enc.update(s, 30'000), 1u);
+    EXPECT_EQ(sent.back().id, 0x200u);
+    EXPECT_EQ(sent.back().data[0] & 1, 0);
+
+    // Brake, accel and steering refresh at 100 ms, DOW at 500 ms
+    EXPECT_EQ(enc.update(s, 120'000), 2u);  // ACCEL and STEER, last sent at 0 and 20 ms
+    EXPECT_EQ(enc.update(s, 130'000), 1u);  // BRAKE
+    EXPECT_EQ(enc.framesSent(), 9u);
+    EXPECT_EQ(enc.framesSuppressed(), 4u * 6 - 9u);
+}
+
+TEST(ActuatorEncoder, SmallRequestReturningToZeroIsSent) {
+    std::size_t frames = 0;
+    ActuatorEncoder enc([&frames](const CanFrame&) { ++frames; });
+    VehicleState s;
+    enc.update(s, 0);
+    s.steering_angle_rad = 0.001f;  // Below the deadband, so held back
+    EXPECT_EQ(enc.update(s, 1'000), 0u);
+    s.steering_angle_rad = 0.0f;    // Last sent was 0: still nothing to do
+    EXPECT_EQ(enc.update(s, 2'000), 0u);
+
+    s.steering_angle_rad = 0.01f;
+    EXPECT_EQ(enc.update(s, 3'000), 1u);
+    s.steering_angle_rad = 0.0f;
+    EXPECT_EQ(enc.update(s, 4'000), 1u);
+
+    enc.invalidate();
+    EXPECT_EQ(enc.update(s, 5'000), 4u);
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include "adas/common/Seqlock.hpp"
+#include "adas/diagnostics/DiagServer.hpp"
+#include "adas/features/AdasManager.hpp"
+
+using namespace adas;
+using namespace adas::diagnostics;
+
+namespace {
+
+struct Pair {
+    uint64_t a = 0;
+    uint64_t b = 0;  // Always a * 3
+};
+
+std::string socketPath(const char* name) {
+    return "/tmp/adas_test_" + std::to_string(::getpid()) + "_" + name + ".sock";
+}
+
+} // namespace
+
+TEST(Seqlock, ReadersNeverSeeTornValues) {
+    common::Seqlock<Pair> lock;
+    std::atomic<bool>     done{false};
+    std::thread writer([&] {
+        for (uint64_t i = 1; i <= 100'000; ++i) lock.write({i, i * 3});
+        done = true;
+    });
+    uint64_t reads = 0, version = 0;
+    while (!done) {
+        Pair p;
+        if (!lock.tryRead(p, &version)) continue;
+        ASSERT_EQ(p.b, p.a * 3);
+        EXPECT_EQ(version, p.a);
+        ++reads;
+    }
+    writer.join();
+    EXPECT_EQ(lock.read(&version).a, 100'000u);
+    EXPECT_EQ(version, 100'000u);
+}
+
+TEST(DiagServer, ServesLatestManagerCycleToSeveralClients) {
+    features::AdasManager mgr;
+    DiagServer server(mgr.diagSnapshot());
+    const std::string path = socketPath("diag");
+    ASSERT_TRUE(server.start(path));
+    EXPECT_FALSE(server.start(path));
+
+    mgr.publish(events::EventType::SPEED_UPDATE, events::SpeedData{20.0f});
+    for (uint64_t t = 0; t < 3; ++t) {
+        mgr.publish(events::EventType::RADAR_UPDATE, events::RadarData{25.0f, 0.0f, 0.9f});
+        VehicleState state;
+        mgr.execute(state, 100 * t);
+    }
+
+    DiagClient a, b;
+    ASSERT_TRUE(a.connect(path));
+    ASSERT_TRUE(b.connect(path));
+    DiagFrame frame;
+    uint64_t  version = 0;
+    for (int i = 0; i < 50; ++i) {
+        ASSERT_TRUE(a.poll(frame, &version));
+        ASSERT_TRUE(b.poll(frame));
+    }
+    EXPECT_EQ(version, 3u);
+    EXPECT_EQ(frame.cycle, 2u);
+    EXPECT_EQ(frame.time_ms, 200u);
+    EXPECT_TRUE(frame.state.brake_requested);  // 25 m at 20 m/s closing
+    EXPECT_EQ(frame.feature_count, 4u);
+    EXPECT_GT(frame.feature_ns[0], 0u);
+    EXPECT_EQ(frame.dtc_count, mgr.dtcManager().entries().size());
+    ASSERT_GT(frame.recent_count, 0u);
+    EXPECT_EQ(frame.recent[frame.recent_count - 1].code,
+              static_cast<uint32_t>(mgr.dtcManager().entries().back().code));
+
+    server.stop();
+    EXPECT_EQ(server.repliesSent(), 100u);  // Counted after each send: read once the thread is joined
+    EXPECT_FALSE(a.poll(frame));
+    EXPECT_NE(::access(path.c_str(), F_OK), 0);  // Socket file removed
+}
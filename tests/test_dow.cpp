@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include "adas/events/EventBus.hpp"
 #include "adas/features/DowFeature.hpp"
 #include "adas/diagnostics/DTCManager.hpp"
 #include "adas/VehicleState.hpp"
@@ -36,3 +37,27 @@ TEST(DowFeature, NoWarningWhenVehicleFar) {
     dow.execute(state, dtc, 0);
     EXPECT_FALSE(state.dow_warning);
 }
+
+// The bus filter lets through only reports that change the decision, so a
+// filtered DOW warns exactly when an unfiltered one does.
+TEST(DowFeature, RadarFilterKeepsWarningDecision) {
+    DowFeature filtered, reference;
+    EventBus bus;
+    bus.subscribe(EventType::RADAR_UPDATE, &filtered, EventPriority::NORMAL, 0, filtered.radarFilter());
+    bus.subscribe(EventType::RADAR_UPDATE, &reference);
+    bus.subscribe(EventType::DOOR_UPDATE, &filtered);
+    bus.subscribe(EventType::DOOR_UPDATE, &reference);
+
+    DTCManager dtc;
+    for (int i = 0; i < 200; ++i) {
+        if (i % 50 == 0) bus.publish(EventType::DOOR_UPDATE, DoorData{i % 100 == 0});
+        // A target closing from 40 m, with sensor noise on every field
+        const float noise = (i % 3 - 1) * 0.05f;
+        bus.publish(EventType::RADAR_UPDATE, RadarData{40.0f - 0.2f * i + noise, 4.0f + noise, 0.9f + noise});
+        adas::VehicleState a, b;
+        filtered.execute(a, dtc, i);
+        reference.execute(b, dtc, i);
+        ASSERT_EQ(a.dow_warning, b.dow_warning) << i;
+    }
+    EXPECT_GT(bus.filteredCount(&filtered), 190u);
+}
@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "adas/diagnostics/DTCManager.hpp"
+#include "adas/diagnostics/DTCSink.hpp"
+
+using namespace adas::diagnostics;
+
+static DTCManager makeLog() {
+    DTCManager dtc;
+    dtc.report(DTC::AEB_SENSOR_FAULT,   Severity::WARNING, "AEB: sensor not ready",      100);
+    dtc.report(DTC::AEB_ACTIVATED,      Severity::INFO,    "AEB: full emergency brake",  200);
+    dtc.report(DTC::LKA_LOW_CONFIDENCE, Severity::WARNING, "LKA: camera confidence low", 300);
+    dtc.report(DTC::AEB_ACTIVATED,      Severity::INFO,    "AEB: full emergency brake",  400);
+    return dtc;
+}
+
+TEST(DTCManager, QueryByCode) {
+    DTCManager dtc = makeLog();
+    DTCQuery q;
+    q.code = DTC::AEB_ACTIVATED;
+    auto result = dtc.query(q);
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_EQ(result[0]->timestamp_ms, 200u);
+    EXPECT_EQ(result[1]->timestamp_ms, 400u);
+}
+
+TEST(DTCManager, QueryBySeverityAndTimeRange) {
+    DTCManager dtc = makeLog();
+    DTCQuery q;
+    q.severity = Severity::WARNING;
+    q.from_ms  = 150;
+    q.to_ms    = 300;  // inclusive
+    auto result = dtc.query(q);
+    ASSERT_EQ(result.size(), 1u);
+    EXPECT_EQ(result[0]->code, DTC::LKA_LOW_CONFIDENCE);
+}
+
+TEST(DTCManager, QueryReturnsTimestampOrderForLateReports) {
+    DTCManager dtc = makeLog();
+    dtc.report(DTC::DOW_SENSOR_FAULT, Severity::WARNING, "DOW: late", 250);
+    DTCQuery q;
+    q.from_ms = 200;
+    q.to_ms   = 300;
+    auto result = dtc.query(q);
+    ASSERT_EQ(result.size(), 3u);
+    EXPECT_EQ(result[0]->timestamp_ms, 200u);
+    EXPECT_EQ(result[1]->timestamp_ms, 250u);
+    EXPECT_EQ(result[2]->timestamp_ms, 300u);
+}
+
+TEST(DTCManager, ClearKeepsIndexConsistent) {
+    DTCManager dtc = makeLog();
+    dtc.clear(DTC::AEB_ACTIVATED);
+    EXPECT_FALSE(dtc.hasActive(DTC::AEB_ACTIVATED));
+    auto result = dtc.query(DTCQuery{});
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_EQ(result[0]->code, DTC::AEB_SENSOR_FAULT);
+    EXPECT_EQ(result[1]->code, DTC::LKA_LOW_CONFIDENCE);
+
+    dtc.clear();
+    EXPECT_TRUE(dtc.entries().empty());
+    EXPECT_TRUE(dtc.query(DTCQuery{}).empty());
+    dtc.report(DTC::DOW_WARNING_ACTIVE, Severity::WARNING, "DOW: after clear", 500);
+    ASSERT_EQ(dtc.query(DTCQuery{}).size(), 1u);
+}
+
+// Four threads post interleaved timestamps in whatever order the scheduler
+// picks; one cycle's merge must give the same log on every run.
+TEST(DTCManager, PostedReportsMergeInDeterministicOrder) {
+    auto run = [](bool reverse_start) {
+        DTCManager dtc;
+        constexpr int kThreads = 4;
+        constexpr int kReports = 40;  // Per thread, within kPostCapacity
+        std::vector<std::thread> threads;
+        for (int n = 0; n < kThreads; ++n) {
+            const int t = reverse_start ? kThreads - 1 - n : n;
+            threads.emplace_back([&dtc, t] {
+                const DTC code = (t % 2) ? DTC::LKA_LOW_CONFIDENCE : DTC::AEB_SENSOR_FAULT;
+                for (int i = 0; i < kReports; ++i) {
+                    dtc.post(code, Severity::WARNING, t < 2 ? "low" : "high", 10 * (kReports - i));
+                    std::this_thread::yield();
+                }
+            });
+        }
+        for (auto& th : threads) th.join();
+        EXPECT_EQ(dtc.mergePosted(), static_cast<std::size_t>(kThreads * kReports));
+        EXPECT_EQ(dtc.mergePosted(), 0u);
+        return dtc;
+    };
+
+    const DTCManager a = run(false);
+    const DTCManager b = run(true);
+    ASSERT_EQ(a.entries().size(), b.entries().size());
+    for (std::size_t i = 0; i < a.entries().size(); ++i) {
+        EXPECT_EQ(a.entries()[i].timestamp_ms, b.entries()[i].timestamp_ms) << i;
+        EXPECT_EQ(a.entries()[i].code, b.entries()[i].code) << i;
+        EXPECT_EQ(a.entries()[i].message, b.entries()[i].message) << i;
+    }
+    EXPECT_EQ(a.entries().front().timestamp_ms, 10u);
+    EXPECT_EQ(a.entries().front().code, DTC::AEB_SENSOR_FAULT);
+    EXPECT_EQ(a.entries().front().message, "high");
+    EXPECT_EQ(a.droppedPosts(), 0u);
+}
+
+TEST(DTCManager, FullPostBufferDropsAndCounts) {
+    DTCManager dtc;
+    for (std::size_t i = 0; i < DTCManager::kPostCapacity + 5; ++i) {
+        dtc.post(DTC::AEB_ACTIVATED, Severity::INFO, std::string(100, 'x').c_str(), i);
+    }
+    EXPECT_EQ(dtc.droppedPosts(), 5u);
+    EXPECT_EQ(dtc.mergePosted(), DTCManager::kPostCapacity);
+    EXPECT_EQ(dtc.entries().back().message.size(), DTCManager::kPostedMessageLength);
+}
+
+// Short-lived posting threads must not leave their buffers behind.
+TEST(DTCManager, MergeFreesBuffersOfExitedThreads) {
+    DTCManager dtc;
+    for (int round = 0; round < 20; ++round) {
+        std::thread([&dtc, round] {
+            for (std::size_t i = 0; i < DTCManager::kPostCapacity + 1; ++i) {
+                dtc.post(DTC::AEB_ACTIVATED, Severity::INFO, "worker", static_cast<uint64_t>(round));
+            }
+        }).join();
+    }
+    dtc.post(DTC::AEB_SENSOR_FAULT, Severity::WARNING, "main", 100);
+    EXPECT_EQ(dtc.postBuffers(), 21u);
+
+    EXPECT_EQ(dtc.mergePosted(), 20 * DTCManager::kPostCapacity + 1);
+    EXPECT_EQ(dtc.postBuffers(), 1u);  // Only this thread's is left
+    EXPECT_EQ(dtc.droppedPosts(), 20u);
+
+    dtc.post(DTC::AEB_SENSOR_FAULT, Severity::WARNING, "main", 200);
+    EXPECT_EQ(dtc.mergePosted(), 1u);
+}
+
+TEST(DTCManager, MovedFromManagerDropsPosts) {
+    DTCManager from;
+    from.post(DTC::AEB_ACTIVATED, Severity::INFO, "before", 1);
+    DTCManager to(std::move(from));
+    from.post(DTC::AEB_ACTIVATED, Severity::INFO, "after", 2);
+    EXPECT_EQ(from.mergePosted(), 0u);
+    EXPECT_EQ(from.droppedPosts(), 0u);
+    EXPECT_EQ(to.mergePosted(), 1u);
+    EXPECT_EQ(to.entries().front().message, "before");
+}
+
+TEST(DTCSink, JsonLinesExport) {
+    DTCManager dtc;
+    dtc.report(DTC::AEB_ACTIVATED, Severity::INFO, "say \"brake\"", 1000);
+    std::ostringstream out;
+    JsonLinesSink sink(out);
+    EXPECT_EQ(dtc.exportTo(DTCQuery{}, sink), 1u);
+    EXPECT_EQ(out.str(),
+              "{\"code\":\"0x1002\",\"severity\":\"INFO\",\"timestamp_ms\":1000,"
+              "\"message\":\"say \\\"brake\\\"\"}\n");
+}
+
+TEST(DTCSink, CsvExportQuotesSeparators) {
+    DTCManager dtc;
+    dtc.report(DTC::DOW_WARNING_ACTIVE, Severity::WARNING, "door, open", 5);
+    std::ostringstream out;
+    CsvSink sink(out);
+    dtc.exportTo(DTCQuery{}, sink);
+    EXPECT_EQ(out.str(), "code,severity,timestamp_ms,message\n"
+                         "0x1006,WARN,5,\"door, open\"\n");
+}
+
+TEST(DTCSink, BinaryExportIsCompact) {
+    DTCManager dtc = makeLog();
+    std::ostringstream out;
+    BinarySink sink(out);
+    DTCQuery q;
+    q.code = DTC::AEB_ACTIVATED;
+    dtc.exportTo(q, sink);
+
+    const std::string bytes = out.str();
+    const std::size_t msg   = std::string("AEB: full emergency brake").size();
+    ASSERT_EQ(bytes.size(), 5u + 2 * (2 + 1 + 8 + 2 + msg));
+    EXPECT_EQ(bytes.substr(0, 4), "ADTC");
+    EXPECT_EQ(static_cast<uint8_t>(bytes[5]), 0x02);  // low byte of 0x1002
+    EXPECT_EQ(static_cast<uint8_t>(bytes[6]), 0x10);
+}
@@ -1,4 +1,10 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "adas/events/EventBus.hpp"
 #include "adas/events/IEventSubscriber.hpp"
 
@@ -42,3 +48,248 @@ TEST(EventBus, MultipleSubscribersReceiveEvent) {
     EXPECT_TRUE(a.received);
     EXPECT_TRUE(b.received);
 }
+
+// Appends its id to a shared log on every event, optionally taking a while.
+class OrderedSubscriber : public IEventSubscriber {
+public:
+    OrderedSubscriber(int id, std::vector<int>& log, int busy_us = 0)
+        : id_(id), log_(log), busy_us_(busy_us) {}
+
+    void onEvent(EventType, const EventData&) override {
+        log_.push_back(id_);
+        if (busy_us_ > 0) std::this_thread::sleep_for(std::chrono::microseconds(busy_us_));
+    }
+
+private:
+    int               id_;
+    std::vector<int>& log_;
+    int               busy_us_;
+};
+
+TEST(EventBus, SubscribersServedInPriorityOrder) {
+    EventBus bus;
+    std::vector<int> log;
+    OrderedSubscriber low(1, log), normal(2, log), critical(3, log), normal2(4, log);
+    bus.subscribe(EventType::RADAR_UPDATE, &low, EventPriority::LOW);
+    bus.subscribe(EventType::RADAR_UPDATE, &normal);
+    bus.subscribe(EventType::RADAR_UPDATE, &critical, EventPriority::CRITICAL);
+    bus.subscribe(EventType::RADAR_UPDATE, &normal2);
+    bus.publish(EventType::RADAR_UPDATE, RadarData{30.0f, 0.0f, 0.9f});
+    EXPECT_EQ(log, (std::vector<int>{3, 2, 4, 1}));
+}
+
+TEST(EventBus, SlowHandlerMakesLaterSubscriberMissDeadline) {
+    EventBus bus;
+    std::vector<int> log;
+    OrderedSubscriber slow(1, log, 5000), tight(2, log);
+    bus.subscribe(EventType::LANE_UPDATE, &slow, EventPriority::HIGH);
+    bus.subscribe(EventType::LANE_UPDATE, &tight, EventPriority::NORMAL, 1000);
+    bus.publish(EventType::LANE_UPDATE, LaneData{0.1f, 0.9f});
+
+    auto misses = bus.takeDeadlineMisses();
+    ASSERT_EQ(misses.size(), 1u);
+    EXPECT_EQ(misses[0].subscriber, &tight);
+    EXPECT_EQ(misses[0].type, EventType::LANE_UPDATE);
+    EXPECT_GE(misses[0].latency_us, 5000u);
+    EXPECT_EQ(misses[0].deadline_us, 1000u);
+    EXPECT_TRUE(bus.takeDeadlineMisses().empty());
+    EXPECT_EQ(bus.deadlineMissCount(), 1u);
+}
+
+TEST(EventBus, CriticalSubscriberMeetsDeadlineDespiteSlowPeers) {
+    EventBus bus;
+    std::vector<int> log;
+    OrderedSubscriber slow(1, log, 5000), aeb(2, log);
+    bus.subscribe(EventType::RADAR_UPDATE, &slow);
+    bus.subscribe(EventType::RADAR_UPDATE, &aeb, EventPriority::CRITICAL, 1000);
+    bus.publish(EventType::RADAR_UPDATE, RadarData{30.0f, 0.0f, 0.9f});
+    EXPECT_TRUE(bus.takeDeadlineMisses().empty());
+}
+
+TEST(EventBus, PendingEventsDrainMostUrgentFirst) {
+    EventBus bus;
+    std::vector<int> log;
+    OrderedSubscriber lka(1, log), aeb(2, log);
+    bus.subscribe(EventType::LANE_UPDATE,  &lka, EventPriority::NORMAL);
+    bus.subscribe(EventType::RADAR_UPDATE, &aeb, EventPriority::CRITICAL);
+
+    bus.post(EventType::LANE_UPDATE,  LaneData{0.1f, 0.9f});
+    bus.post(EventType::LANE_UPDATE,  LaneData{0.2f, 0.9f});
+    bus.post(EventType::RADAR_UPDATE, RadarData{30.0f, 0.0f, 0.9f});
+    bus.post(EventType::DOOR_UPDATE,  DoorData{true});  // no subscribers: dropped
+    EXPECT_EQ(bus.pendingCount(), 3u);
+
+    EXPECT_EQ(bus.dispatchPending(), 3u);
+    EXPECT_EQ(log, (std::vector<int>{2, 1, 1}));
+    EXPECT_EQ(bus.pendingCount(), 0u);
+}
+
+namespace {
+
+class CountingSubscriber : public IEventSubscriber {
+public:
+    std::atomic<uint64_t> count{0};
+    void onEvent(EventType, const EventData&) override { count.fetch_add(1, std::memory_order_relaxed); }
+};
+
+} // namespace
+
+TEST(EventBus, UnsubscribeStopsDelivery) {
+    EventBus bus;
+    CountingSubscriber a, b;
+    bus.subscribe(EventType::RADAR_UPDATE, &a);
+    bus.subscribe(EventType::SPEED_UPDATE, &a);
+    bus.subscribe(EventType::RADAR_UPDATE, &b);
+    EXPECT_EQ(bus.unsubscribe(EventType::RADAR_UPDATE, &a), 1u);
+    EXPECT_EQ(bus.unsubscribe(EventType::RADAR_UPDATE, &a), 0u);
+    bus.publish(EventType::RADAR_UPDATE, RadarData{});
+    bus.publish(EventType::SPEED_UPDATE, SpeedData{});
+    EXPECT_EQ(a.count, 1u);  // Speed only
+    EXPECT_EQ(b.count, 1u);
+
+    EXPECT_EQ(bus.unsubscribe(&a), 1u);
+    EXPECT_EQ(bus.subscriberCount(EventType::SPEED_UPDATE), 0u);
+    EXPECT_EQ(bus.subscriberCount(EventType::RADAR_UPDATE), 1u);
+    EXPECT_EQ(bus.retiredLists(), 0u);  // No publisher was running: freed at once
+}
+
+TEST(EventBus, DeadbandAndIntervalFiltersDropRedundantEvents) {
+    EventBus bus;
+    uint64_t now = 0;
+    bus.setClock([&] { return now; });
+    CountingSubscriber all, banded;
+    EventFilter filter;
+    filter.addDeadband(FilterField::RADAR_DISTANCE, 0.5f);
+    filter.addDeadband(FilterField::RADAR_CONFIDENCE, 0.0f, 0.1f);
+    filter.min_interval_us = 10'000;
+    filter.refresh_us      = 100'000;
+    bus.subscribe(EventType::RADAR_UPDATE, &all);
+    bus.subscribe(EventType::RADAR_UPDATE, &banded, EventPriority::NORMAL, 0, filter);
+
+    auto publishAt = [&](uint64_t t_us, float distance, float confidence) {
+        now = t_us;
+        bus.publish(EventType::RADAR_UPDATE, RadarData{distance, 0.0f, confidence});
+    };
+    publishAt(0,       30.0f, 0.90f);  // First: delivered
+    publishAt(5'000,   35.0f, 0.90f);  // Moved, but only 5 ms after the last delivery
+    publishAt(20'000,  30.3f, 0.95f);  // Inside both bands
+    publishAt(40'000,  30.0f, 0.80f);  // Confidence moved more than 10%
+    publishAt(60'000,  30.4f, 0.80f);  // Inside both bands
+    publishAt(140'000, 30.0f, 0.80f);  // Refresh after 100 ms
+    EXPECT_EQ(all.count, 6u);
+    EXPECT_EQ(banded.count, 3u);
+    EXPECT_EQ(bus.filteredCount(&banded), 3u);
+
+    bus.resetFilters();
+    publishAt(141'000, 30.0f, 0.80f);
+    EXPECT_EQ(banded.count, 4u);
+}
+
+TEST(EventBus, PredicateRunsBeforeDelivery) {
+    EventBus bus;
+    CountingSubscriber sub;
+    bool door_open = false;
+    EventFilter filter;
+    filter.context   = &door_open;
+    filter.predicate = [](const void* open, EventType, const EventData&) {
+        return *static_cast<const bool*>(open);
+    };
+    bus.subscribe(EventType::RADAR_UPDATE, &sub, EventPriority::NORMAL, 0, filter);
+    bus.publish(EventType::RADAR_UPDATE, RadarData{});
+    door_open = true;
+    bus.publish(EventType::RADAR_UPDATE, RadarData{});
+    EXPECT_EQ(sub.count, 1u);
+}
+
+// Publishers on many threads while another thread keeps attaching and
+// detaching a tap: the permanent subscriber must see every event exactly once.
+TEST(EventBus, ConcurrentPublishWhileSubscriptionsChange) {
+    constexpr int      kPublishers = 8;
+    constexpr uint64_t kEvents     = 20'000;
+    EventBus bus;
+    CountingSubscriber permanent, tap;
+    bus.subscribe(EventType::RADAR_UPDATE, &permanent, EventPriority::CRITICAL);
+
+    std::atomic<bool> done{false};
+    std::thread churn([&] {
+        while (!done.load()) {
+            bus.subscribe(EventType::RADAR_UPDATE, &tap, EventPriority::LOW);
+            std::this_thread::yield();
+            bus.unsubscribe(EventType::RADAR_UPDATE, &tap);
+        }
+    });
+    std::vector<std::thread> publishers;
+    for (int p = 0; p < kPublishers; ++p) {
+        publishers.emplace_back([&bus] {
+            for (uint64_t i = 0; i < kEvents; ++i) bus.publish(EventType::RADAR_UPDATE, RadarData{});
+        });
+    }
+    for (auto& t : publishers) t.join();
+    done = true;
+    churn.join();
+
+    EXPECT_EQ(permanent.count, kPublishers * kEvents);
+    EXPECT_LE(tap.count, kPublishers * kEvents);
+    bus.synchronize();  // Frees every list retired while the publishers ran
+    EXPECT_EQ(bus.retiredLists(), 0u);
+}
+
+TEST(PayloadPool, PublishedPayloadIsSharedAndRecycled) {
+    struct Holder : IEventSubscriber {
+        Pooled<DetectionList> kept;
+        void onEvent(EventType, const EventData& data) override {
+            kept = std::get<ObjectListData>(data).objects;
+        }
+    } a, b, c;
+
+    PayloadPool<DetectionList> pool(2);
+    EventBus bus;
+    for (Holder* h : {&a, &b, &c}) bus.subscribe(EventType::OBJECT_LIST_UPDATE, h);
+
+    {
+        PooledWriter<DetectionList> objects = pool.acquire();
+        ASSERT_TRUE(objects);
+        objects->count = 3;
+        ObjectListData frame;
+        frame.objects = std::move(objects);
+        bus.publish(EventType::OBJECT_LIST_UPDATE, frame);
+
+        // Every subscriber holds the producer's slab, not a copy.
+        EXPECT_EQ(a.kept.get(), frame.objects.get());
+        EXPECT_EQ(c.kept.get(), frame.objects.get());
+        EXPECT_EQ(frame.objects.useCount(), 4u);
+        EXPECT_EQ(pool.available(), 1u);
+    }
+    EXPECT_EQ(b.kept->count, 3u);
+
+    for (Holder* h : {&a, &b, &c}) h->kept = Pooled<DetectionList>();
+    EXPECT_EQ(pool.available(), 2u);
+}
+
+TEST(PayloadPool, ExhaustedPoolReturnsEmptyHandle) {
+    PayloadPool<LanePolyline> pool(1);
+    Pooled<LanePolyline> first  = pool.acquire();
+    Pooled<LanePolyline> second = pool.acquire();
+    EXPECT_TRUE(first);
+    EXPECT_FALSE(second);
+    EXPECT_EQ(pool.exhaustedCount(), 1u);
+}
+
+TEST(PayloadPool, UnpublishedWriterReturnsSlab) {
+    PayloadPool<LanePolyline> pool(1);
+    {
+        PooledWriter<LanePolyline> draft = pool.acquire();
+        ASSERT_TRUE(draft);
+        draft->lane_count = 2;
+        EXPECT_EQ(pool.available(), 0u);
+    }
+    EXPECT_EQ(pool.available(), 1u);
+
+    // Once shared, the payload is read-only
+    const Pooled<LanePolyline> shared = pool.acquire();
+    static_assert(std::is_same<decltype(shared.operator->()), const LanePolyline*>::value,
+                  "Pooled<T> must not hand out a writable payload");
+    static_assert(!std::is_constructible<PooledWriter<LanePolyline>, const Pooled<LanePolyline>&>::value,
+                  "a shared payload cannot be made writable again");
+    EXPECT_EQ(shared->lane_count, 2u);  // Slabs keep their previous contents
+}
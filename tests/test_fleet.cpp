@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "adas/features/AdasManager.hpp"
+#include "adas/features/FleetManager.hpp"
+
+using namespace adas;
+using namespace adas::features;
+using namespace adas::events;
+
+namespace {
+
+// Sensor inputs that exercise every feature branch across the fleet. An
+// AdasManager needs the radar report repeated until its tracker confirms it.
+template <typename Publish>
+void publishTo(VehicleId i, Publish&& publish, int radar_reports = 1) {
+    const float v = static_cast<float>(i);
+    if (i % 5 != 0) publish(EventType::SPEED_UPDATE, SpeedData{10.0f + v});
+    for (int k = 0; k < radar_reports; ++k) {
+        publish(EventType::RADAR_UPDATE, RadarData{5.0f + 4.0f * v, (i % 3) * 2.0f, (i % 7) ? 0.9f : 0.3f});
+    }
+    publish(EventType::LANE_UPDATE, LaneData{(static_cast<int>(i % 9) - 4) * 0.15f, (i % 4) ? 0.8f : 0.2f});
+    publish(EventType::DOOR_UPDATE, DoorData{i % 2 == 0});
+}
+
+} // namespace
+
+TEST(FleetManager, MatchesOneAdasManagerPerVehicle) {
+    constexpr VehicleId kVehicles = 40;
+    FleetManager fleet;
+    fleet.reserve(kVehicles);
+    std::vector<AdasManager> managers(kVehicles);
+
+    for (VehicleId i = 0; i < kVehicles; ++i) {
+        ASSERT_EQ(fleet.addVehicle(), i);
+        publishTo(i, [&](EventType t, const EventData& d) { fleet.publish(i, t, d); });
+        // A still clock: the repeated reports leave the track exactly on them
+        managers[i].setClock([] { return uint64_t{1000}; });
+        publishTo(i, [&](EventType t, const EventData& d) { managers[i].publish(t, d); }, 3);
+    }
+    fleet.execute(100);
+
+    for (VehicleId i = 0; i < kVehicles; ++i) {
+        VehicleState expected;
+        managers[i].execute(expected, 100);
+        VehicleState got;
+        ASSERT_TRUE(fleet.state(i, got));
+        EXPECT_EQ(got.brake_requested, expected.brake_requested) << i;
+        EXPECT_FLOAT_EQ(got.brake_intensity, expected.brake_intensity) << i;
+        EXPECT_FLOAT_EQ(got.ego_acceleration, expected.ego_acceleration) << i;
+        EXPECT_FLOAT_EQ(got.steering_angle_rad, expected.steering_angle_rad) << i;
+        EXPECT_EQ(got.dow_warning, expected.dow_warning) << i;
+    }
+    EXPECT_LE(FleetManager::kBytesPerVehicle, 128u);
+}
+
+TEST(FleetManager, RejectsUnknownVehicleIds) {
+    FleetManager fleet;
+    EXPECT_FALSE(fleet.publish(0, EventType::SPEED_UPDATE, SpeedData{20.0f}));
+    const VehicleId id = fleet.addVehicle();
+    EXPECT_TRUE(fleet.publish(id, EventType::SPEED_UPDATE, SpeedData{20.0f}));
+    EXPECT_FALSE(fleet.publish(id + 1, EventType::SPEED_UPDATE, SpeedData{20.0f}));
+    fleet.execute(0);
+
+    VehicleState state;
+    EXPECT_TRUE(fleet.state(id, state));
+    EXPECT_FLOAT_EQ(state.ego_speed_mps, 20.0f);
+    EXPECT_FALSE(fleet.state(id + 1, state));
+    EXPECT_FALSE(fleet.state(UINT32_MAX, state));
+}
+
+TEST(FleetManager, ReportsDtcsWhenConditionStarts) {
+    FleetManager fleet;
+    fleet.addVehicle();
+    const VehicleId faulty = fleet.addVehicle();
+    fleet.publish(0, EventType::SPEED_UPDATE, SpeedData{20.0f});
+    fleet.publish(0, EventType::LANE_UPDATE, LaneData{0.0f, 0.9f});
+    fleet.publish(0, EventType::RADAR_UPDATE, RadarData{100.0f, 20.0f, 0.9f});
+    fleet.publish(faulty, EventType::LANE_UPDATE, LaneData{0.0f, 0.9f});  // no speed yet
+
+    fleet.execute(0);
+    fleet.execute(10);
+    // Vehicle 1 has no speed: AEB and ACC faults, once each despite two cycles
+    ASSERT_EQ(fleet.dtcManager().entries().size(), 2u);
+    EXPECT_EQ(fleet.dtcManager().entries()[0].code, diagnostics::DTC::AEB_SENSOR_FAULT);
+    EXPECT_EQ(fleet.dtcManager().entries()[1].code, diagnostics::DTC::ACC_SENSOR_FAULT);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "adas/features/ControlKernels.hpp"
+
+using namespace adas::features;
+
+TEST(ControlKernels, AebBatchClassifiesEachVehicle) {
+    //                         full   partial  receding  low conf  no speed
+    std::vector<float>   dist  {30.0f, 60.0f,   50.0f,    20.0f,    20.0f};
+    std::vector<float>   tgt   {0.0f,  0.0f,    35.0f,    0.0f,     0.0f};
+    std::vector<float>   ego   {30.0f, 30.0f,   30.0f,    30.0f,    30.0f};
+    std::vector<float>   conf  {0.9f,  0.9f,    0.9f,     0.2f,     0.9f};
+    std::vector<uint8_t> valid {1,     1,       1,        1,        0};
+    std::vector<float>   intensity(5);
+    std::vector<uint8_t> level(5);
+
+    computeAebBatch({dist.data(), tgt.data(), ego.data(), conf.data(), valid.data()},
+                    {intensity.data(), level.data()}, 5, AebCalibration{});
+
+    EXPECT_EQ(level[0], static_cast<uint8_t>(AebLevel::FULL));
+    EXPECT_FLOAT_EQ(intensity[0], 1.0f);
+    EXPECT_EQ(level[1], static_cast<uint8_t>(AebLevel::PARTIAL));
+    EXPECT_NEAR(intensity[1], 2.0f / 3.0f, 1e-6f);  // TTC 2.0s between 1.5s and 3.0s
+    EXPECT_EQ(level[2], static_cast<uint8_t>(AebLevel::NONE));
+    EXPECT_EQ(level[3], static_cast<uint8_t>(AebLevel::SENSOR_FAULT));
+    EXPECT_EQ(level[4], static_cast<uint8_t>(AebLevel::SENSOR_FAULT));
+    EXPECT_FLOAT_EQ(intensity[2] + intensity[3] + intensity[4], 0.0f);
+}
+
+namespace {
+
+// The ACC law as AccFeature wrote it before the batch kernels, kept here as
+// an independent reference for them.
+float referenceAccAccel(float ego, float set, float dist, float tgt, float conf,
+                        const AccCalibration& cal) {
+    float desired_speed = set;
+    if (conf >= cal.min_confidence && dist < cal.follow_range_m) {
+        float gap_error = dist - cal.min_gap_m;
+        if (gap_error < 0.0f) {
+            desired_speed = std::max(0.0f, tgt);
+        } else {
+            desired_speed = std::min(set, tgt + gap_error * cal.gap_gain);
+        }
+    }
+    float raw_accel = (desired_speed - ego) * cal.speed_gain;
+    return std::clamp(raw_accel, -cal.max_decel_mps2, cal.max_accel_mps2);
+}
+
+} // namespace
+
+TEST(ControlKernels, AccBatchMatchesReferenceLawOverGrid) {
+    // Includes each threshold: min gap 30 m, follow range 150 m, confidence 0.6
+    std::vector<float> ego, set, dist, tgt, conf;
+    for (float e : {0.0f, 15.0f, 30.0f})
+        for (float s : {20.0f, 33.33f})
+            for (float d : {5.0f, 29.0f, 30.0f, 31.0f, 80.0f, 149.0f, 150.0f, 999.0f})
+                for (float t : {0.0f, 10.0f, 40.0f})
+                    for (float c : {0.3f, 0.6f, 0.9f}) {
+                        ego.push_back(e); set.push_back(s); dist.push_back(d);
+                        tgt.push_back(t); conf.push_back(c);
+                    }
+    const std::size_t n = ego.size();
+    std::vector<uint8_t> valid(n, 1), active(n);
+    std::vector<float>   accel(n);
+    const AccCalibration cal;
+    computeAccBatch({ego.data(), set.data(), dist.data(), tgt.data(), conf.data(), valid.data()},
+                    {accel.data(), active.data()}, n, cal);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(active[i], 1);
+        EXPECT_FLOAT_EQ(accel[i], referenceAccAccel(ego[i], set[i], dist[i], tgt[i], conf[i], cal))
+            << "ego " << ego[i] << " set " << set[i] << " dist " << dist[i] << " tgt " << tgt[i]
+            << " conf " << conf[i];
+    }
+}
+
+TEST(ControlKernels, AccBatchInactiveWithoutSpeed) {
+    float ego = 20.0f, set = 33.33f, dist = 999.0f, tgt = 0.0f, conf = 0.9f, accel = -1.0f;
+    uint8_t valid = 0, active = 1;
+    computeAccBatch({&ego, &set, &dist, &tgt, &conf, &valid}, {&accel, &active}, 1,
+                    AccCalibration{});
+    EXPECT_EQ(active, 0);
+    EXPECT_FLOAT_EQ(accel, 0.0f);
+}
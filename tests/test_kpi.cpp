@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include "adas/diagnostics/KpiAggregator.hpp"
+#include "adas/features/AdasManager.hpp"
+
+using namespace adas;
+using namespace adas::diagnostics;
+using namespace adas::events;
+
+TEST(QuantileSketch, QuantilesWithinRelativeError) {
+    QuantileSketch s;
+    for (int i = 1; i <= 1000; ++i) s.record(i * 0.01);  // 0.01 .. 10.0
+    EXPECT_EQ(s.count(), 1000u);
+    EXPECT_DOUBLE_EQ(s.min(), 0.01);
+    EXPECT_DOUBLE_EQ(s.max(), 10.0);
+    for (double q : {0.1, 0.5, 0.9, 0.99}) {
+        const double exact = std::ceil(q * 1000) * 0.01;
+        EXPECT_NEAR(s.quantile(q), exact, exact * QuantileSketch::kRelativeError) << q;
+    }
+}
+
+TEST(QuantileSketch, MergeEqualsSingleStream) {
+    QuantileSketch whole, a, b;
+    for (int i = 0; i < 5000; ++i) {
+        const double v = std::fmod(i * 0.7919, 50.0);
+        whole.record(v);
+        (i % 3 ? a : b).record(v);
+    }
+    a.merge(b);
+    EXPECT_EQ(a.buckets(), whole.buckets());
+    EXPECT_EQ(a.count(), whole.count());
+    EXPECT_EQ(a.min(), whole.min());
+    EXPECT_EQ(a.max(), whole.max());
+    for (double q : {0.01, 0.5, 0.999}) EXPECT_EQ(a.quantile(q), whole.quantile(q));
+}
+
+TEST(KpiAggregator, ManagerTracksTtcAndAebActivations) {
+    features::AdasManager mgr;
+    for (uint64_t t = 0; t < 5; ++t) {
+        mgr.publish(EventType::SPEED_UPDATE, SpeedData{20.0f});
+        // 40 m closing at 20 m/s: TTC 2.0 s partially brakes
+        mgr.publish(EventType::RADAR_UPDATE, RadarData{t < 3 ? 40.0f : 999.0f, 0.0f, 0.9f});
+        VehicleState state;
+        mgr.execute(state, t * 100);
+    }
+    const KpiAggregator& k = mgr.kpis();
+    EXPECT_EQ(k.counters().cycles, 5u);
+    // The tracker confirms the target on its third report (t=2); the clear
+    // path at t=3 ends braking at once
+    EXPECT_EQ(k.counters().aeb_activations, 1u);
+    EXPECT_EQ(k.counters().aeb_active_cycles, 1u);
+    EXPECT_EQ(k.ttc().count(), 3u);  // No target, no TTC
+    EXPECT_NEAR(k.ttc().min(), 2.0, 1e-6);
+
+    KpiAggregator twice;
+    twice.merge(k);
+    twice.merge(k);
+    EXPECT_EQ(twice.counters().aeb_activations, 2u);
+    EXPECT_EQ(twice.ttc().count(), 6u);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "adas/features/LaneGeometry.hpp"
+#include "adas/features/LkaFeature.hpp"
+
+using namespace adas;
+using namespace adas::events;
+using namespace adas::features;
+
+namespace {
+
+// Centre line y = offset + curvature/2 · x², sampled every step metres from x = -10.
+std::vector<LanePoint> centreLine(float offset, float curvature, std::size_t points, float step) {
+    std::vector<LanePoint> line(points);
+    for (std::size_t i = 0; i < points; ++i) {
+        const float x = -10.0f + step * static_cast<float>(i);
+        line[i]       = {x, offset + 0.5f * curvature * x * x};
+    }
+    return line;
+}
+
+} // namespace
+
+TEST(LaneGeometry, StraightLineGivesConstantOffset) {
+    LaneGeometry g;
+    const auto line = centreLine(0.4f, 0.0f, 20, 5.0f);
+    ASSERT_TRUE(g.build(line.data(), line.size()));
+    EXPECT_NEAR(g.length(), 95.0f, 1e-3f);
+    EXPECT_NEAR(g.previewDeviation(0.0f), -0.4f, 1e-4f);   // Ego is left of the centre line
+    EXPECT_NEAR(g.previewDeviation(30.0f), -0.4f, 1e-4f);
+    EXPECT_NEAR(g.previewDeviation(200.0f), -0.4f, 1e-4f);  // Past the end: extended straight
+
+    EXPECT_FALSE(g.build(line.data(), 1));
+    EXPECT_FALSE(g.valid());
+}
+
+TEST(LaneGeometry, CurveShowsUpInPreview) {
+    LaneGeometry g;
+    const auto line = centreLine(0.0f, 0.002f, 40, 2.5f);  // 500 m radius, bending right
+    ASSERT_TRUE(g.build(line.data(), line.size()));
+    EXPECT_NEAR(g.previewDeviation(0.0f), 0.0f, 1e-3f);
+    // Driving straight for 25 m leaves the ego 0.625 m left of a right-hand bend
+    EXPECT_NEAR(g.previewDeviation(25.0f), -0.625f, 0.02f);
+}
+
+TEST(LaneGeometry, QueriesIndependentOfSourceDensity) {
+    LaneGeometry coarse;
+    LaneGeometry fine;
+    const auto few  = centreLine(0.2f, 0.002f, 41, 2.5f);
+    const auto many = centreLine(0.2f, 0.002f, 10001, 0.01f);
+    ASSERT_TRUE(coarse.build(few.data(), few.size()));
+    ASSERT_TRUE(fine.build(many.data(), many.size()));
+    for (float d : {0.0f, 10.0f, 40.0f}) {
+        EXPECT_NEAR(coarse.previewDeviation(d), fine.previewDeviation(d), 0.01f) << d;
+    }
+}
+
+TEST(LaneGeometry, LkaSteersOnPreviewDeviation) {
+    LkaCalibration cal;
+    cal.lookahead_s = 1.0f;
+    LkaFeature lka(cal);
+    PayloadPool<LanePolyline> pool(1);
+
+    PooledWriter<LanePolyline> lanes = pool.acquire();
+    const auto line                  = centreLine(0.0f, 0.002f, 40, 2.5f);
+    lanes->lane_count                = 1;
+    lanes->point_count[0]            = static_cast<uint32_t>(line.size());
+    std::copy(line.begin(), line.end(), lanes->points[0].begin());
+    lanes->confidence[0]             = 0.9f;
+    LaneGeometryData frame;
+    frame.lanes             = std::move(lanes);
+    frame.stamp.acquired_us = 1'000;
+    lka.onEvent(EventType::LANE_GEOMETRY_UPDATE, frame);
+
+    // Centred now, so a stationary ego has nothing to correct
+    diagnostics::DTCManager dtc;
+    VehicleState            state;
+    lka.execute(state, dtc, 1);
+    EXPECT_FLOAT_EQ(state.steering_angle_rad, 0.0f);
+
+    // At 25 m/s the 1 s preview sees the bend and steers right
+    lka.onEvent(EventType::SPEED_UPDATE, SpeedData{25.0f});
+    lka.execute(state, dtc, 2);
+    EXPECT_NEAR(state.steering_angle_rad, 0.5f * 0.625f, 0.02f);
+    EXPECT_EQ(state.steering_input.source, EventType::LANE_GEOMETRY_UPDATE);
+    EXPECT_EQ(state.steering_input.acquired_us, 1'000u);
+}
+
+// A later LANE_UPDATE outranks older geometry, and an empty geometry frame
+// drops the centre line altogether.
+TEST(LaneGeometry, LkaSteersOnNewerInput) {
+    LkaCalibration cal;
+    cal.lookahead_s = 1.0f;
+    LkaFeature lka(cal);
+    PayloadPool<LanePolyline> pool(2);
+
+    PooledWriter<LanePolyline> lanes = pool.acquire();
+    const auto line                  = centreLine(0.0f, 0.002f, 40, 2.5f);
+    lanes->lane_count                = 1;
+    lanes->point_count[0]            = static_cast<uint32_t>(line.size());
+    std::copy(line.begin(), line.end(), lanes->points[0].begin());
+    lanes->confidence[0]             = 0.9f;
+    LaneGeometryData frame;
+    frame.lanes             = std::move(lanes);
+    frame.stamp.acquired_us = 1'000;
+    lka.onEvent(EventType::LANE_GEOMETRY_UPDATE, frame);
+    lka.onEvent(EventType::SPEED_UPDATE, SpeedData{25.0f});
+
+    LaneData lane;
+    lane.lateral_deviation_m = -0.8f;
+    lane.confidence          = 0.9f;
+    lane.stamp.acquired_us   = 2'000;
+    lka.onEvent(EventType::LANE_UPDATE, lane);
+
+    diagnostics::DTCManager dtc;
+    VehicleState            state;
+    lka.execute(state, dtc, 1);
+    EXPECT_NEAR(state.steering_angle_rad, 0.5f * 0.8f, 1e-4f);  // Steers back right
+    EXPECT_EQ(state.steering_input.source, EventType::LANE_UPDATE);
+    EXPECT_EQ(state.steering_input.acquired_us, 2'000u);
+
+    // Newer geometry takes over again
+    frame.stamp.acquired_us = 3'000;
+    lka.onEvent(EventType::LANE_GEOMETRY_UPDATE, frame);
+    state = VehicleState{};
+    lka.execute(state, dtc, 2);
+    EXPECT_EQ(state.steering_input.source, EventType::LANE_GEOMETRY_UPDATE);
+
+    // No lane in the next frame: back to LANE_UPDATE even though it is older
+    PooledWriter<LanePolyline> none = pool.acquire();
+    none->lane_count = 0;
+    LaneGeometryData empty;
+    empty.lanes             = std::move(none);
+    empty.stamp.acquired_us = 4'000;
+    lka.onEvent(EventType::LANE_GEOMETRY_UPDATE, empty);
+    state = VehicleState{};
+    lka.execute(state, dtc, 3);
+    EXPECT_EQ(state.steering_input.source, EventType::LANE_UPDATE);
+    EXPECT_NEAR(state.steering_angle_rad, 0.5f * 0.8f, 1e-4f);  // Steers back right
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include "adas/diagnostics/LatencyTracker.hpp"
+#include "adas/events/EventBus.hpp"
+#include "adas/features/AdasManager.hpp"
+
+using namespace adas;
+using namespace adas::diagnostics;
+using namespace adas::events;
+
+TEST(LatencyHistogram, QuantilesFollowPowerOfTwoBuckets) {
+    LatencyHistogram h;
+    for (uint64_t us : {0, 3, 100, 100, 100, 100, 100, 100, 100, 5000}) h.record(us);
+    EXPECT_EQ(h.count(), 10u);
+    EXPECT_EQ(h.minUs(), 0u);
+    EXPECT_EQ(h.maxUs(), 5000u);
+    EXPECT_EQ(h.meanUs(), 5703u / 10);
+    EXPECT_EQ(h.quantileUs(0.5), 128u);    // 100 µs lands in [64, 128)
+    EXPECT_EQ(h.quantileUs(1.0), 5000u);   // clamped to the largest sample
+    EXPECT_EQ(h.buckets()[0], 1u);
+    EXPECT_EQ(h.buckets()[2], 1u);         // 3 µs in [2, 4)
+}
+
+TEST(EventBus, StampsPublishTimeAndDefaultsAcquisition) {
+    struct Capture : IEventSubscriber {
+        EventStamp stamp;
+        void onEvent(EventType, const EventData& data) override { stamp = stampOf(data); }
+    } sub;
+
+    EventBus bus;
+    bus.setClock([] { return uint64_t{5000}; });
+    bus.subscribe(EventType::SPEED_UPDATE, &sub);
+
+    bus.publish(EventType::SPEED_UPDATE, SpeedData{10.0f});
+    EXPECT_EQ(sub.stamp.published_us, 5000u);
+    EXPECT_EQ(sub.stamp.acquired_us, 5000u);
+
+    SpeedData sampled{10.0f};
+    sampled.stamp.acquired_us = 4200;
+    bus.publish(EventType::SPEED_UPDATE, sampled);
+    EXPECT_EQ(sub.stamp.published_us, 5000u);
+    EXPECT_EQ(sub.stamp.acquired_us, 4200u);
+}
+
+// A queued event keeps the time it was posted, so queueing counts as latency.
+TEST(EventBus, PostedEventKeepsPostTime) {
+    struct Capture : IEventSubscriber {
+        EventStamp stamp;
+        void onEvent(EventType, const EventData& data) override { stamp = stampOf(data); }
+    } sub;
+
+    uint64_t now_us = 5000;
+    EventBus bus;
+    bus.setClock([&now_us] { return now_us; });
+    bus.subscribe(EventType::SPEED_UPDATE, &sub);
+
+    bus.post(EventType::SPEED_UPDATE, SpeedData{10.0f});
+    now_us = 9000;
+    EXPECT_EQ(bus.dispatchPending(), 1u);
+    EXPECT_EQ(sub.stamp.published_us, 5000u);
+    EXPECT_EQ(sub.stamp.acquired_us, 5000u);
+}
+
+TEST(LatencyTracker, RecordsRadarToBrakeAgeFromOldestInput) {
+    uint64_t now_us = 0;
+    features::AdasManager mgr;
+    mgr.setClock([&now_us] { return now_us; });
+
+    // Three reports confirm the lead; each was sampled before it was published.
+    RadarData radar{20.0f, 0.0f, 0.95f};   // TTC 0.67 s: full brake
+    now_us = 1500;
+    for (uint64_t acquired_us : {400, 700, 1000}) {
+        radar.stamp.acquired_us = acquired_us;
+        mgr.publish(EventType::RADAR_UPDATE, radar);
+    }
+    now_us = 1800;
+    mgr.publish(EventType::SPEED_UPDATE, SpeedData{30.0f});
+
+    VehicleState state;
+    now_us = 2600;
+    mgr.execute(state, 2);
+    ASSERT_TRUE(state.brake_requested);
+    EXPECT_EQ(state.brake_input.source, EventType::LEAD_UPDATE);  // older than the speed sample
+    EXPECT_EQ(state.brake_input.acquired_us, 1000u);
+
+    const auto& brake = mgr.latency().histogram(EventType::LEAD_UPDATE, Actuator::BRAKE);
+    ASSERT_EQ(brake.count(), 1u);
+    EXPECT_EQ(brake.maxUs(), 1600u);
+    EXPECT_EQ(mgr.latency().histogram(EventType::LEAD_UPDATE, Actuator::ACCELERATION).count(), 1u);
+
+    std::ostringstream json;
+    mgr.latency().writeJson(json);
+    EXPECT_NE(json.str().find("\"LEAD_UPDATE->BRAKE\": {\"count\": 1"), std::string::npos);
+    EXPECT_EQ(json.str().find("STEERING"), std::string::npos);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "adas/features/AdasManager.hpp"
+#include "adas/features/DowFeature.hpp"
+#include "adas/features/LoadShedder.hpp"
+
+using namespace adas;
+using namespace adas::features;
+using namespace adas::events;
+
+namespace {
+
+LoadShedConfig budget1ms() {
+    LoadShedConfig c;
+    c.budget_us      = 1000;
+    c.restore_cycles = 3;
+    return c;
+}
+
+} // namespace
+
+TEST(LoadShedder, DisabledWithoutBudget) {
+    LoadShedder shedder;
+    EXPECT_EQ(shedder.update(50'000'000), 0);
+    EXPECT_EQ(shedder.level(), 0);
+}
+
+TEST(LoadShedder, EscalatesOnOverrunAndRestoresWithHysteresis) {
+    LoadShedder shedder(budget1ms());
+    EXPECT_EQ(shedder.update(900'000), 1);  // 90% of budget
+    EXPECT_EQ(shedder.update(900'000), 1);
+    EXPECT_EQ(shedder.level(), 2);
+
+    // Between restore (50%) and shed (80%): hold, and reset the calm count.
+    EXPECT_EQ(shedder.update(400'000), 0);
+    EXPECT_EQ(shedder.update(400'000), 0);
+    EXPECT_EQ(shedder.update(600'000), 0);
+    EXPECT_EQ(shedder.update(400'000), 0);
+    EXPECT_EQ(shedder.update(400'000), 0);
+    EXPECT_EQ(shedder.level(), 2);
+    EXPECT_EQ(shedder.update(400'000), -1);
+    EXPECT_EQ(shedder.level(), 1);
+}
+
+TEST(LoadShedder, PolicyNeverTouchesSafetyOrControl) {
+    LoadShedder shedder(budget1ms());
+    for (int i = 0; i < 10; ++i) shedder.update(2'000'000);
+    EXPECT_EQ(shedder.level(), LoadShedder::kMaxLevel);
+    for (uint64_t cycle = 0; cycle < 8; ++cycle) {
+        EXPECT_TRUE(shedder.shouldRun(Criticality::SAFETY, cycle));
+        EXPECT_TRUE(shedder.shouldRun(Criticality::CONTROL, cycle));
+        EXPECT_FALSE(shedder.shouldRun(Criticality::ASSIST, cycle));
+        EXPECT_FALSE(shedder.shouldRun(Criticality::CONVENIENCE, cycle));
+    }
+}
+
+TEST(LoadShedder, DecimatedClassRunsOneCycleInN) {
+    LoadShedder shedder(budget1ms());
+    shedder.update(900'000);  // level 1: CONVENIENCE decimated by 4
+    int runs = 0;
+    for (uint64_t cycle = 0; cycle < 16; ++cycle) {
+        runs += shedder.shouldRun(Criticality::CONVENIENCE, cycle) ? 1 : 0;
+    }
+    EXPECT_EQ(runs, 4);
+}
+
+TEST(AdasManager, ShedsLaneKeepingButStillBrakesUnderOverload) {
+    AdasManager mgr;
+    LoadShedConfig config = budget1ms();
+    config.shed_ratio = 0.0f;  // every cycle counts as an overrun
+    mgr.setLoadShedding(config);
+
+    VehicleState state;
+    for (uint64_t t = 0; t < 3; ++t) mgr.execute(state, t);
+    EXPECT_EQ(mgr.loadShedder().level(), 3);
+    EXPECT_TRUE(mgr.dtcManager().hasActive(diagnostics::DTC::LOAD_SHED_ACTIVE));
+
+    mgr.publish(EventType::SPEED_UPDATE, SpeedData{30.0f});
+    for (int k = 0; k < 3; ++k) {  // Confirms the tracker's lead
+        mgr.publish(EventType::RADAR_UPDATE, RadarData{20.0f, 0.0f, 0.95f});
+    }
+    mgr.publish(EventType::LANE_UPDATE,  LaneData{0.8f, 0.9f});
+    state = VehicleState{};
+    state.ego_speed_mps = 30.0f;
+    mgr.execute(state, 3);
+    EXPECT_TRUE(state.brake_requested);
+    EXPECT_FLOAT_EQ(state.steering_angle_rad, 0.0f);
+}
+
+TEST(AdasManager, SkippedFeatureHoldsItsSteering) {
+    AdasManager mgr;
+    LoadShedConfig config = budget1ms();
+    config.shed_ratio = 0.0f;  // Level 0, 1, 2 (LKA decimated), then 3 (LKA shed)
+    mgr.setLoadShedding(config);
+    mgr.publish(EventType::LANE_UPDATE, LaneData{0.8f, 0.9f});
+
+    VehicleState first;
+    mgr.execute(first, 0);
+    ASSERT_NE(first.steering_angle_rad, 0.0f);
+    for (uint64_t t = 1; t < 6; ++t) {
+        VehicleState state;  // Callers start each cycle from a fresh state
+        mgr.execute(state, t);
+        EXPECT_FLOAT_EQ(state.steering_angle_rad, first.steering_angle_rad) << "cycle " << t;
+        EXPECT_EQ(state.steering_input.acquired_us, first.steering_input.acquired_us);
+        EXPECT_EQ(state.steering_input.source, first.steering_input.source);
+    }
+    EXPECT_EQ(mgr.loadShedder().level(), LoadShedder::kMaxLevel);
+}
+
+TEST(DowFeature, CriticalityDependsOnMotion) {
+    DowFeature dow;
+    VehicleState state;
+    EXPECT_EQ(dow.criticality(state), Criticality::SAFETY);
+    state.ego_speed_mps = 10.0f;
+    EXPECT_EQ(dow.criticality(state), Criticality::CONVENIENCE);
+}
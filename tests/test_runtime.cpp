@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "adas/runtime/AdasRuntime.hpp"
+
+using namespace adas;
+using namespace adas::features;
+using namespace adas::runtime;
+
+TEST(AdasRuntime, RunsFixedPeriodCyclesOnAbsoluteDeadlines) {
+    AdasManager mgr;
+    RuntimeConfig config;
+    config.period_us = 2000;
+    AdasRuntime rt(mgr, config);
+
+    uint64_t inputs = 0, outputs = 0;
+    const auto start = std::chrono::steady_clock::now();
+    rt.run([&](AdasManager& m, VehicleState& state, uint64_t) {
+               ++inputs;
+               state.ego_speed_mps = 20.0f;
+               m.publish(events::EventType::SPEED_UPDATE, events::SpeedData{20.0f});
+           },
+           [&](const VehicleState&, uint64_t) { ++outputs; },
+           25);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(inputs, 25u);
+    EXPECT_EQ(outputs, 25u);
+    EXPECT_EQ(rt.stats().cycles, 25u);
+    EXPECT_EQ(rt.stats().jitter_us.count(), 25u);
+    EXPECT_GE(rt.stats().min_jitter_ns, 0);  // never wakes before the deadline
+    // 25 deadlines, the first one period after start.
+    EXPECT_GE(elapsed, std::chrono::microseconds(25 * 2000));
+}
+
+TEST(AdasRuntime, StopEndsLoopAfterCurrentCycle) {
+    AdasManager mgr;
+    RuntimeConfig config;
+    config.period_us = 500;
+    AdasRuntime rt(mgr, config);
+    rt.run(nullptr, [&](const VehicleState&, uint64_t cycle) {
+        if (cycle == 4) rt.stop();
+    });
+    EXPECT_EQ(rt.stats().cycles, 5u);
+
+    // Consumed by that run: the next one is not stopped
+    rt.run(nullptr, nullptr, 3);
+    EXPECT_EQ(rt.stats().cycles, 3u);
+}
+
+TEST(AdasRuntime, StopBeforeRunIsNotLost) {
+    AdasManager mgr;
+    AdasRuntime rt(mgr);
+    rt.stop();
+    rt.run(nullptr, nullptr);  // Would never return if the stop were dropped
+    EXPECT_EQ(rt.stats().cycles, 0u);
+}
+
+// stop() from another thread once the loop is known to be running.
+TEST(AdasRuntime, StopFromAnotherThread) {
+    AdasManager mgr;
+    RuntimeConfig config;
+    config.period_us = 500;
+    AdasRuntime rt(mgr, config);
+
+    std::mutex              mutex;
+    std::condition_variable cv;
+    bool                    running = false;
+    std::thread stopper([&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return running; });
+        rt.stop();
+    });
+    rt.run(nullptr, [&](const VehicleState&, uint64_t) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = true;
+        }
+        cv.notify_one();
+    });
+    stopper.join();
+    EXPECT_GE(rt.stats().cycles, 1u);
+}
+
+TEST(AdasRuntime, OverrunsSkipMissedDeadlines) {
+    AdasManager mgr;
+    RuntimeConfig config;
+    config.period_us = 1000;
+    AdasRuntime rt(mgr, config);
+    rt.run([](AdasManager&, VehicleState&, uint64_t cycle) {
+               // Sleeps at least this long, however loaded the machine
+               if (cycle == 1) std::this_thread::sleep_for(std::chrono::microseconds(3500));
+           },
+           nullptr, 4);
+    EXPECT_GE(rt.stats().overruns, 1u);
+    EXPECT_GE(rt.stats().missed_periods, 3u);
+    EXPECT_GE(rt.stats().max_busy_ns, 3'500'000u);
+}
+
+TEST(AdasRuntime, ThreadSettingsFallBackWhenNotPermitted) {
+    AdasManager mgr;
+    RuntimeConfig config;
+    config.cpu = 100000;  // no such CPU
+    AdasRuntime rt(mgr, config);
+    const ThreadSetup setup = rt.applyThreadSettings();
+    EXPECT_FALSE(setup.pinned);
+    EXPECT_FALSE(setup.fifo);  // not requested
+}
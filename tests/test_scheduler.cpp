@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "adas/sim/EventScheduler.hpp"
+
+using namespace adas::sim;
+
+TEST(EventScheduler, RunsMultiRateSourcesInTimeThenPhaseOrder) {
+    EventScheduler sched;
+    std::vector<std::string> log;
+    auto note = [&](const char* tag) {
+        return [&log, tag](uint64_t now_us) { log.push_back(tag + std::to_string(now_us / 1000)); };
+    };
+    sched.every(100'000, 0, Phase::CONTROL, note("C"));
+    sched.every(50'000, 0, Phase::SENSOR, note("R"));
+    sched.at(100'000, Phase::TRIGGER, note("T"));
+
+    EXPECT_EQ(sched.runUntil(100'000), 6u);
+    EXPECT_EQ(log, (std::vector<std::string>{"R0", "C0", "R50", "T100", "R100", "C100"}));
+    EXPECT_EQ(sched.now(), 100'000u);
+}
+
+TEST(EventScheduler, ClockJumpsOverIdleTime) {
+    EventScheduler sched;
+    std::vector<uint64_t> seen;
+    sched.at(5'000'000, Phase::SENSOR, [&](uint64_t now_us) { seen.push_back(now_us); });
+    sched.at(9'000'000, Phase::SENSOR, [&](uint64_t now_us) { seen.push_back(now_us); });
+    EXPECT_EQ(sched.run(), 2u);
+    EXPECT_EQ(seen, (std::vector<uint64_t>{5'000'000, 9'000'000}));
+    EXPECT_EQ(sched.pending(), 0u);
+}
+
+TEST(EventScheduler, ActionsCanCancelAndScheduleTasks) {
+    EventScheduler sched;
+    int ticks = 0;
+    EventScheduler::TaskId tick = 0;
+    tick = sched.every(10, 0, Phase::CONTROL, [&](uint64_t now_us) {
+        ++ticks;
+        if (now_us == 30) {
+            sched.cancel(tick);
+            sched.at(now_us + 5, Phase::TRIGGER, [&](uint64_t) { sched.stop(); });
+        }
+    });
+    sched.run();
+    EXPECT_EQ(ticks, 4);  // 0, 10, 20, 30
+    EXPECT_EQ(sched.now(), 35u);
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "adas/common/MpscQueue.hpp"
+#include "adas/common/SpscQueue.hpp"
+#include "adas/features/AdasManager.hpp"
+
+using namespace adas;
+using namespace adas::events;
+using namespace adas::features;
+
+TEST(SpscQueue, KeepsOrderAcrossThreadsAndWraps) {
+    common::SpscQueue<uint32_t> q(5);
+    EXPECT_EQ(q.capacity(), 8u);
+    for (uint32_t i = 0; i < 8; ++i) EXPECT_TRUE(q.push(i));
+    EXPECT_FALSE(q.push(8));
+
+    uint32_t v = 0;
+    for (uint32_t i = 0; i < 8; ++i) {
+        ASSERT_TRUE(q.pop(v));
+        EXPECT_EQ(v, i);
+    }
+    EXPECT_FALSE(q.pop(v));
+
+    // Yield when blocked so this also finishes quickly on a single core
+    constexpr uint32_t kItems = 200'000;
+    std::thread producer([&q] {
+        for (uint32_t i = 0; i < kItems;) {
+            if (q.push(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    uint32_t expected = 0;
+    while (expected < kItems) {
+        if (!q.pop(v)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(v, expected);
+        ++expected;
+    }
+    producer.join();
+}
+
+TEST(MpscQueue, KeepsEachProducersOrderAndWraps) {
+    common::MpscQueue<uint32_t> q(5);
+    EXPECT_EQ(q.capacity(), 8u);
+    for (uint32_t i = 0; i < 8; ++i) EXPECT_TRUE(q.push(i));
+    EXPECT_FALSE(q.push(8));
+    EXPECT_EQ(q.pushed(), 8u);
+
+    uint32_t v = 0;
+    for (uint32_t i = 0; i < 8; ++i) {
+        ASSERT_TRUE(q.pop(v));
+        EXPECT_EQ(v, i);
+    }
+    EXPECT_FALSE(q.pop(v));
+
+    // Four producers tag items with their index in the top byte
+    constexpr uint32_t kProducers = 4;
+    constexpr uint32_t kItems     = 50'000;
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&q, p] {
+            for (uint32_t i = 0; i < kItems;) {
+                if (q.push((p << 24) | i)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    std::vector<uint32_t> next(kProducers, 0);
+    for (uint32_t received = 0; received < kProducers * kItems;) {
+        if (!q.pop(v)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(v & 0xFFFFFFu, next[v >> 24]++);
+        ++received;
+    }
+    for (auto& t : producers) t.join();
+    EXPECT_FALSE(q.pop(v));
+}
+
+namespace {
+
+// Target closing in: partial braking under the default calibration from
+// TTC 3 s, under the candidate's only from TTC 2 s.
+void driveApproach(AdasManager& mgr, std::vector<VehicleState>& outputs) {
+    mgr.publish(EventType::SPEED_UPDATE, SpeedData{20.0f});
+    for (int k = 0; k < 30; ++k) {
+        RadarData radar{80.0f - 2.0f * k, 10.0f, 0.9f};
+        radar.stamp.acquired_us = 100'000u * (k + 1);  // Tracker runs on sample time
+        mgr.publish(EventType::RADAR_UPDATE, radar);
+        VehicleState state;
+        state.ego_speed_mps = 20.0f;
+        mgr.execute(state, 100u * k);
+        outputs.push_back(state);
+    }
+}
+
+} // namespace
+
+TEST(ShadowRunner, IdenticalCandidatesNeverDiverge) {
+    AdasManager mgr;
+    ASSERT_TRUE(mgr.enableShadow(makeFeatureSet(AdasCalibration{})));
+    EXPECT_FALSE(mgr.enableShadow(makeFeatureSet(AdasCalibration{})));
+    std::vector<VehicleState> outputs;
+    driveApproach(mgr, outputs);
+
+    mgr.shadow()->drain();
+    EXPECT_EQ(mgr.shadow()->cyclesCompared(), 30u);
+    EXPECT_EQ(mgr.shadow()->divergentCycles(), 0u);
+    EXPECT_EQ(mgr.shadow()->stats().dropped, 0u);
+    // Speed, then radar, lead, cycle mark and the track lists the tracker's pool allowed
+    EXPECT_EQ(mgr.shadow()->stats().enqueued, 1u + 30u * 3 + (30u - mgr.tracker().droppedTrackLists()));
+
+    // Swap in another candidate while running
+    EXPECT_TRUE(mgr.disableShadow());
+    EXPECT_EQ(mgr.shadow(), nullptr);
+    EXPECT_TRUE(mgr.enableShadow(makeFeatureSet(AdasCalibration{})));
+    VehicleState state;
+    mgr.execute(state, 3000);
+    mgr.shadow()->drain();
+    EXPECT_EQ(mgr.shadow()->cyclesCompared(), 1u);
+}
+
+TEST(ShadowRunner, LogsCandidateDivergenceWithoutTouchingProduction) {
+    AdasCalibration candidate;
+    candidate.aeb.partial_brake_ttc_s = 2.0f;
+
+    AdasManager plain;
+    AdasManager shadowed;
+    ASSERT_TRUE(shadowed.enableShadow(makeFeatureSet(candidate)));
+    std::vector<VehicleState> expected, got;
+    driveApproach(plain, expected);
+    driveApproach(shadowed, got);
+    for (std::size_t i = 0; i < got.size(); ++i) {
+        EXPECT_EQ(got[i].brake_requested, expected[i].brake_requested) << i;
+        EXPECT_FLOAT_EQ(got[i].brake_intensity, expected[i].brake_intensity) << i;
+    }
+
+    const ShadowRunner& shadow = *shadowed.shadow();
+    shadow.drain();
+    ASSERT_GT(shadow.divergentCycles(), 0u);
+    const std::vector<ShadowDivergence> log = shadow.divergences();
+    ASSERT_FALSE(log.empty());
+    // Production brakes first; the candidate holds off
+    EXPECT_EQ(log.front().field, ShadowField::BRAKE_REQUESTED);
+    EXPECT_FLOAT_EQ(log.front().production, 1.0f);
+    EXPECT_FLOAT_EQ(log.front().candidate, 0.0f);
+    EXPECT_GT(shadow.stats().total_enqueue_ns, 0u);
+}
+
+// The bus lets any thread publish: events from several at once must all be
+// accounted for and handed over whole.
+TEST(ShadowRunner, TakesEventsFromSeveralPublishers) {
+    constexpr int kThreads = 4;
+    constexpr int kEvents  = 5000;
+    ShadowConfig config;
+    config.queue_capacity = 1024;  // Small enough that some pushes fail
+    ShadowRunner shadow(makeFeatureSet(AdasCalibration{}), config);
+
+    std::vector<std::thread> publishers;
+    for (int t = 0; t < kThreads; ++t) {
+        publishers.emplace_back([&shadow, t] {
+            for (int i = 0; i < kEvents; ++i) {
+                shadow.onEvent(EventType::SPEED_UPDATE, SpeedData{static_cast<float>(t)});
+            }
+        });
+    }
+    for (auto& p : publishers) p.join();
+    EXPECT_EQ(shadow.stats().enqueued + shadow.stats().dropped, uint64_t{kThreads} * kEvents);
+
+    // Once drained, the queue has room for the cycle mark
+    shadow.drain();
+    shadow.endCycle(VehicleState{}, 1);
+    shadow.drain();
+    EXPECT_EQ(shadow.cyclesCompared(), 1u);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <csignal>
+#include <filesystem>
+#include <fstream>
+#include "adas/sim/ShardedSweep.hpp"
+
+using namespace adas::sim;
+namespace fs = std::filesystem;
+
+namespace {
+
+// 20 grid points in shards of 6: four shards, the last one short.
+SweepConfig smallGrid() {
+    SweepConfig config;
+    config.axes = {{SweepParam::AEB_FULL_BRAKE_TTC, 1.0f, 3.0f, 5},
+                   {SweepParam::TARGET_DECEL, 3.0f, 9.0f, 4}};
+    return config;
+}
+
+std::string freshDir(const char* name) {
+    const std::string dir = ::testing::TempDir() + name;
+    fs::remove_all(dir);
+    return dir;
+}
+
+} // namespace
+
+TEST(ShardedSweep, MultiProcessMergeMatchesSingleRun) {
+    ParameterSweep sweep(smallGrid());
+    ShardedSweep   shards(sweep, freshDir("adas_shards_merge"), 6);
+    ASSERT_TRUE(shards.prepare());
+    ASSERT_EQ(shards.shardCount(), 4u);
+    EXPECT_EQ(shards.shardRange(3).first, 18u);
+    EXPECT_EQ(shards.shardRange(3).second, 20u);
+
+    ASSERT_TRUE(shards.runLocal(2));
+    EXPECT_EQ(shards.completedShards(), 4u);
+
+    SweepMaps merged;
+    ASSERT_TRUE(shards.merge(merged));
+    const SweepMaps reference = sweep.run(1);
+    EXPECT_EQ(merged.activation, reference.activation);
+    EXPECT_EQ(merged.min_gap_m, reference.min_gap_m);
+    EXPECT_EQ(merged.collision, reference.collision);
+}
+
+TEST(ShardedSweep, ResumeRecomputesOnlyMissingShards) {
+    const std::string dir = freshDir("adas_shards_resume");
+    ParameterSweep sweep(smallGrid());
+    {
+        ShardedSweep shards(sweep, dir, 6);
+        ASSERT_TRUE(shards.prepare());
+        EXPECT_EQ(shards.work(), 4u);
+    }
+
+    // Interrupted before shard 2 finished: neither its claim nor result survive.
+    fs::remove(fs::path(dir) / "shards" / "000002.result");
+    fs::remove(fs::path(dir) / "shards" / "000002.claim");
+
+    ShardedSweep resumed(sweep, dir, 6);
+    ASSERT_TRUE(resumed.prepare());
+    SweepMaps maps;
+    EXPECT_FALSE(resumed.merge(maps));
+    EXPECT_EQ(resumed.work(), 1u);
+    EXPECT_TRUE(resumed.merge(maps));
+
+    // A different shard size is a different campaign.
+    ShardedSweep mismatched(sweep, dir, 5);
+    EXPECT_FALSE(mismatched.prepare());
+}
+
+TEST(ShardedSweep, ClaimOfDeadProcessIsRecovered) {
+    const std::string dir = freshDir("adas_shards_stale");
+    ParameterSweep sweep(smallGrid());
+    ShardedSweep   shards(sweep, dir, 6);
+    ASSERT_TRUE(shards.prepare());
+
+    // A child that exits leaves a pid nobody owns once reaped.
+    const pid_t dead = ::fork();
+    if (dead == 0) ::_exit(0);
+    ASSERT_GT(dead, 0);
+    int status = 0;
+    ::waitpid(dead, &status, 0);
+
+    char host[256] = {};
+    ::gethostname(host, sizeof(host) - 1);
+    std::ofstream(fs::path(dir) / "shards" / "000001.claim") << host << " " << dead << "\n";
+
+    EXPECT_EQ(shards.work(), 3u);  // shard 1 looks taken
+    EXPECT_EQ(shards.recoverStaleClaims(), 1u);
+    EXPECT_EQ(shards.work(), 1u);
+    EXPECT_EQ(shards.completedShards(), 4u);
+}
+
+TEST(ShardedSweep, FailedShardReleasesItsClaimAndFailsTheWorker) {
+    const std::string dir = freshDir("adas_shards_failed");
+    ParameterSweep sweep(smallGrid());
+    ShardedSweep   shards(sweep, dir, 20);  // One shard, a 145-byte result
+    ASSERT_TRUE(shards.prepare());
+
+    // Files over 100 bytes cannot be written: the claim fits, the result does not.
+    const pid_t pid = ::fork();
+    if (pid == 0) {
+        std::signal(SIGXFSZ, SIG_IGN);
+        const rlimit limit{100, 100};
+        ::setrlimit(RLIMIT_FSIZE, &limit);
+        ::_exit(shards.runLocal(2) ? 0 : 1);
+    }
+    ASSERT_GT(pid, 0);
+    int status = 0;
+    ::waitpid(pid, &status, 0);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 1);
+    EXPECT_EQ(shards.completedShards(), 0u);
+    EXPECT_FALSE(fs::exists(fs::path(dir) / "shards" / "000000.claim"));
+
+    std::size_t failed = 1;
+    EXPECT_EQ(shards.work(1, &failed), 1u);
+    EXPECT_EQ(failed, 0u);
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+#include "adas/features/AccFeature.hpp"
+#include "adas/features/AdasManager.hpp"
+#include "adas/snapshot/Snapshot.hpp"
+#include "adas/VehicleState.hpp"
+
+using namespace adas::features;
+using namespace adas::events;
+using namespace adas::diagnostics;
+using namespace adas::snapshot;
+
+TEST(Snapshot, FeatureStateRoundTrip) {
+    AccFeature original(25.0f);
+    original.onEvent(EventType::SPEED_UPDATE, SpeedData{30.0f});
+    original.onEvent(EventType::LEAD_UPDATE, RadarData{10.0f, 5.0f, 0.9f});
+
+    SnapshotWriter out;
+    original.saveState(out);
+
+    AccFeature restored;  // fresh: speed not yet valid, different set speed
+    SnapshotReader in(out.bytes());
+    ASSERT_TRUE(restored.restoreState(in));
+    EXPECT_TRUE(in.atEnd());
+
+    adas::VehicleState a, b;
+    DTCManager dtc_a, dtc_b;
+    original.execute(a, dtc_a, 0);
+    restored.execute(b, dtc_b, 0);
+    EXPECT_FLOAT_EQ(a.ego_acceleration, b.ego_acceleration);
+    EXPECT_TRUE(dtc_b.entries().empty());  // speed_valid_ carried over
+}
+
+TEST(Snapshot, FeatureRejectsBadFlagAndTrailingBytes) {
+    AccFeature original(25.0f);
+    original.onEvent(EventType::SPEED_UPDATE, SpeedData{30.0f});
+    SnapshotWriter out;
+    original.saveState(out);
+
+    std::vector<uint8_t> bad_flag = out.bytes();
+    bad_flag[5 * sizeof(float)] = 2;  // speed_valid_
+    AccFeature restored;
+    SnapshotReader flag_in(bad_flag);
+    EXPECT_FALSE(restored.restoreState(flag_in));
+
+    std::vector<uint8_t> trailing = out.bytes();
+    trailing.push_back(0);
+    SnapshotReader trailing_in(trailing);
+    EXPECT_FALSE(restored.restoreState(trailing_in));
+}
+
+TEST(Snapshot, ReaderFailsOnTruncatedInput) {
+    SnapshotWriter out;
+    out.write(uint32_t{7});
+    std::vector<uint8_t> bytes = out.bytes();
+    bytes.pop_back();
+    SnapshotReader in(bytes);
+    uint32_t value = 0;
+    EXPECT_FALSE(in.read(value));
+    EXPECT_FALSE(in.ok());
+}
+
+TEST(Snapshot, ManagerRestoreReproducesOutputs) {
+    uint64_t    now_us = 10'000;
+    AdasManager recorded;
+    recorded.setClock([&now_us] { return now_us; });
+    recorded.publish(EventType::SPEED_UPDATE, SpeedData{30.0f});
+    recorded.publish(EventType::RADAR_UPDATE, RadarData{60.0f, 0.0f, 0.95f});
+    now_us += 10'000;
+    recorded.publish(EventType::RADAR_UPDATE, RadarData{60.0f, 0.0f, 0.95f});
+    recorded.publish(EventType::LANE_UPDATE,  LaneData{0.5f, 0.9f});
+    adas::VehicleState warmup;
+    recorded.execute(warmup, 100);
+
+    AdasManager replay;
+    replay.setClock([&now_us] { return now_us; });
+    ASSERT_TRUE(replay.restoreSnapshot(recorded.saveSnapshot()));
+    EXPECT_EQ(replay.dtcManager().entries().size(), recorded.dtcManager().entries().size());
+    EXPECT_EQ(replay.tracker().trackCount(), 1u);
+
+    // The third report confirms the restored track on both
+    adas::VehicleState a, b;
+    now_us += 10'000;
+    recorded.publish(EventType::RADAR_UPDATE, RadarData{60.0f, 0.0f, 0.95f});
+    replay.publish(EventType::RADAR_UPDATE, RadarData{60.0f, 0.0f, 0.95f});
+    recorded.execute(a, 200);
+    replay.execute(b, 200);
+    EXPECT_TRUE(b.brake_requested);
+    EXPECT_EQ(a.brake_requested, b.brake_requested);
+    EXPECT_FLOAT_EQ(a.brake_intensity, b.brake_intensity);
+    EXPECT_FLOAT_EQ(a.ego_acceleration, b.ego_acceleration);
+    EXPECT_FLOAT_EQ(a.steering_angle_rad, b.steering_angle_rad);
+}
+
+TEST(Snapshot, ManagerRejectsMalformedImage) {
+    AdasManager mgr;
+    std::vector<uint8_t> image = mgr.saveSnapshot();
+    image[0] ^= 0xFF;  // corrupt the magic
+    EXPECT_FALSE(mgr.restoreSnapshot(image));
+    EXPECT_FALSE(mgr.restoreSnapshot({}));
+}
+
+// A bad block anywhere in the image must leave the whole manager as it was.
+TEST(Snapshot, ManagerRestoreIsAllOrNothing) {
+    AdasManager source;
+    source.publish(EventType::SPEED_UPDATE, SpeedData{30.0f});
+    source.publish(EventType::RADAR_UPDATE, RadarData{20.0f, 0.0f, 0.95f});
+    adas::VehicleState state;
+    source.execute(state, 100);
+    source.execute(state, 200);
+    const std::vector<uint8_t> image = source.saveSnapshot();
+    ASSERT_GE(source.dtcManager().entries().size(), 2u);
+
+    AdasManager target;
+    target.publish(EventType::SPEED_UPDATE, SpeedData{12.0f});
+    target.publish(EventType::LANE_UPDATE,  LaneData{0.3f, 0.9f});
+    target.execute(state, 50);
+    const std::vector<uint8_t> before = target.saveSnapshot();
+
+    // Last DTC index entry repeats the one before: not a permutation
+    std::vector<uint8_t> bad_index = image;
+    std::copy(bad_index.end() - 8, bad_index.end() - 4, bad_index.end() - 4);
+    EXPECT_FALSE(target.restoreSnapshot(bad_index));
+    EXPECT_EQ(target.saveSnapshot(), before);
+
+    // ACC's speed_valid_ flag set to 2, after AEB's block parsed fine
+    std::vector<uint8_t> bad_flag = image;
+    // Header, "AEB" and its 33-byte block, "ACC" and its block length
+    const std::size_t acc_data = 9 + (4 + 3) + (4 + 33) + (4 + 3) + 4;
+    bad_flag[acc_data + 5 * sizeof(float)] = 2;
+    EXPECT_FALSE(target.restoreSnapshot(bad_flag));
+    EXPECT_EQ(target.saveSnapshot(), before);
+
+    ASSERT_TRUE(target.restoreSnapshot(image));
+    EXPECT_EQ(target.saveSnapshot(), image);
+}
+
+TEST(Snapshot, PeriodicCheckpointsAndNearestLookup) {
+    AdasManager mgr;
+    mgr.setCheckpointInterval(1000);
+    adas::VehicleState state;
+    for (uint64_t t = 0; t <= 3500; t += 100) mgr.execute(state, t);
+
+    ASSERT_EQ(mgr.checkpoints().size(), 4u);  // t = 0, 1000, 2000, 3000
+    EXPECT_EQ(mgr.nearestCheckpoint(2999)->time_ms, 2000u);
+    EXPECT_EQ(mgr.nearestCheckpoint(3000)->time_ms, 3000u);
+    EXPECT_EQ(mgr.nearestCheckpoint(99999)->time_ms, 3000u);
+
+    AdasManager empty;
+    EXPECT_EQ(empty.nearestCheckpoint(1000), nullptr);
+}
+
+TEST(Snapshot, CheckpointsKeepOnlyTheLatest) {
+    AdasManager mgr;
+    mgr.setCheckpointInterval(100, 3);
+    adas::VehicleState state;
+    for (uint64_t t = 0; t <= 1000; t += 100) mgr.execute(state, t);
+
+    ASSERT_EQ(mgr.checkpoints().size(), 3u);
+    EXPECT_EQ(mgr.checkpoints().front().time_ms, 800u);
+    EXPECT_EQ(mgr.checkpoints().back().time_ms, 1000u);
+    EXPECT_EQ(mgr.nearestCheckpoint(500), nullptr);  // Dropped
+    EXPECT_EQ(mgr.nearestCheckpoint(950)->time_ms, 900u);
+
+    mgr.setCheckpointInterval(100, 1);  // Shrinking drops the oldest at once
+    ASSERT_EQ(mgr.checkpoints().size(), 1u);
+    EXPECT_EQ(mgr.checkpoints().front().time_ms, 1000u);
+}
+
+// Without inputs every cycle reports sensor faults, so the log outgrows
+// what a checkpoint keeps.
+TEST(Snapshot, CheckpointsKeepOnlyTheLatestDtcs) {
+    AdasManager mgr;
+    mgr.setCheckpointInterval(1000);
+    adas::VehicleState state;
+    for (uint64_t t = 0; t <= 300; ++t) mgr.execute(state, t);
+    const std::size_t logged = mgr.dtcManager().entries().size();
+    ASSERT_GT(logged, AdasManager::kCheckpointDtcEntries);
+    ASSERT_EQ(mgr.checkpoints().back().time_ms, 0u);
+
+    mgr.setCheckpointInterval(1, 1);
+    mgr.execute(state, 301);
+    const auto all = mgr.dtcManager().query(adas::diagnostics::DTCQuery{});
+
+    AdasManager restored;
+    ASSERT_TRUE(restored.restoreSnapshot(mgr.checkpoints().back().image));
+    const auto newest = restored.dtcManager().query(adas::diagnostics::DTCQuery{});
+    ASSERT_EQ(newest.size(), AdasManager::kCheckpointDtcEntries);
+    for (std::size_t i = 0; i < newest.size(); ++i) {
+        const auto* expected = all[all.size() - newest.size() + i];
+        EXPECT_EQ(newest[i]->timestamp_ms, expected->timestamp_ms);
+        EXPECT_EQ(newest[i]->code, expected->code);
+    }
+    EXPECT_EQ(newest.back()->timestamp_ms, 301u);
+}
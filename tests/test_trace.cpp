@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include "adas/trace/Trace.hpp"
+
+using namespace adas;
+
+namespace {
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+
+} // namespace
+
+TEST(Trace, ScopeRecordsOnlyWhileActive) {
+    trace::reset();
+    { trace::Scope s("idle", "test"); }
+    EXPECT_EQ(trace::spanCount(), 0u);
+
+    trace::start();
+    { trace::Scope s("busy", "test"); }
+    trace::stop();
+    EXPECT_EQ(trace::spanCount(), 1u);
+    trace::reset();
+}
+
+TEST(Trace, SpansFromEveryThreadAreExported) {
+    trace::reset();
+    trace::record("main", "test", 1'000'000, 1'002'500);
+    std::thread worker([] { trace::record("worker", "test", 1'001'000, 1'001'250); });
+    worker.join();
+    ASSERT_EQ(trace::spanCount(), 2u);
+
+    const std::string path = ::testing::TempDir() + "adas_trace_test.json";
+    ASSERT_TRUE(trace::writeChromeJson(path));
+    const std::string json = readFile(path);
+    std::remove(path.c_str());
+
+    // Timestamps are µs relative to the earliest span.
+    EXPECT_NE(json.find("{\"name\":\"main\",\"cat\":\"test\",\"ph\":\"X\",\"pid\":1,\"tid\":"),
+              std::string::npos);
+    EXPECT_NE(json.find("\"ts\":0.000,\"dur\":2.500}"), std::string::npos);
+    EXPECT_NE(json.find("\"ts\":1.000,\"dur\":0.250}"), std::string::npos);
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.substr(json.size() - 4), "\n]}\n");
+    trace::reset();
+}
+
+TEST(Trace, FullBufferDropsInsteadOfBlocking) {
+    trace::reset();
+    std::thread worker([] {
+        for (int i = 0; i < (1 << 16) + 10; ++i) trace::record("spin", "test", 1, 2);
+    });
+    worker.join();
+    EXPECT_EQ(trace::spanCount(), std::size_t{1} << 16);
+    EXPECT_EQ(trace::droppedCount(), 10u);
+    trace::reset();
+}
+
+TEST(Trace, NamesAreEscapedInJson) {
+    trace::reset();
+    trace::record("say \"hi\"", "a\\b", 1'000, 2'000);
+
+    const std::string path = ::testing::TempDir() + "adas_trace_escape.json";
+    ASSERT_TRUE(trace::writeChromeJson(path));
+    const std::string json = readFile(path);
+    std::remove(path.c_str());
+    EXPECT_NE(json.find("{\"name\":\"say \\\"hi\\\"\",\"cat\":\"a\\\\b\","), std::string::npos);
+    trace::reset();
+}
+
+TEST(Trace, BuffersGrowOnDemandAndResetFreesThem) {
+    trace::reset();
+    const std::size_t before = trace::bufferBytes();
+    std::thread([] {
+        for (int i = 0; i < 10; ++i) trace::record("few", "test", 1, 2);
+    }).join();
+    // A handful of spans costs a small first block, not the full 64 Ki spans
+    const std::size_t grown = trace::bufferBytes() - before;
+    EXPECT_GT(grown, 0u);
+    EXPECT_LT(grown, (std::size_t{1} << 16) * sizeof(trace::Span) / 32);
+
+    // The worker has exited; reset() frees its buffer along with this thread's
+    trace::reset();
+    EXPECT_EQ(trace::bufferBytes(), 0u);
+    EXPECT_EQ(trace::spanCount(), 0u);
+}
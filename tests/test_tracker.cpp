@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "adas/features/AdasManager.hpp"
+#include "adas/tracking/Tracker.hpp"
+
+using namespace adas;
+using namespace adas::events;
+using namespace adas::tracking;
+
+namespace {
+
+struct Capture {
+    std::vector<RadarData> leads;
+    std::vector<Track>     last_tracks;
+    uint32_t               last_track_count = 0;
+
+    Tracker::Sink sink() {
+        return [this](EventType type, const EventData& data) {
+            if (type == EventType::LEAD_UPDATE) leads.push_back(std::get<RadarData>(data));
+            if (type == EventType::TRACK_UPDATE) {
+                const TrackList& list = *std::get<TrackListData>(data).tracks;
+                last_track_count      = list.count;
+                last_tracks.assign(list.tracks.begin(), list.tracks.begin() + list.count);
+            }
+        };
+    }
+};
+
+DetectionList scanOf(std::initializer_list<Detection> detections) {
+    DetectionList scan;
+    for (const Detection& d : detections) scan.detections[scan.count++] = d;
+    return scan;
+}
+
+} // namespace
+
+TEST(Tracker, ConfirmsLeadAndEstimatesClosingSpeed) {
+    Capture out;
+    Tracker tracker(out.sink());
+    // Target 50 m ahead closing at 5 m/s, plus a car in the next lane
+    for (int k = 0; k < 20; ++k) {
+        const float x = 50.0f - 5.0f * 0.1f * k;
+        tracker.update(scanOf({{x, 0.1f, 0, 0, 4, 2, 0.9f, 1}, {30.0f, 3.5f, 0, 0, 4, 2, 0.9f, 1}}),
+                       100'000u * (k + 1));
+    }
+    EXPECT_EQ(tracker.trackCount(), 2u);
+    EXPECT_EQ(out.last_track_count, 2u);
+    // Unconfirmed until the third hit, and nothing vouches for an empty road
+    EXPECT_FLOAT_EQ(out.leads[1].distance_m, 999.0f);
+    EXPECT_FLOAT_EQ(out.leads[1].confidence, 0.0f);
+    EXPECT_FLOAT_EQ(out.leads[2].confidence, 0.9f);
+    EXPECT_NEAR(out.leads.back().distance_m, 40.5f, 0.2f);
+    EXPECT_NEAR(out.leads.back().target_speed_mps, 0.0f, 0.3f);  // ego 0 m/s, target -5 relative, clamped at 0
+}
+
+// Positions only, with ±0.2 m of noise: velocities come from the filter.
+TEST(Tracker, EstimatesApproachingAndRecedingVelocity) {
+    Capture out;
+    Tracker tracker(out.sink());
+    tracker.onEvent(EventType::SPEED_UPDATE, SpeedData{25.0f});
+    constexpr float kApproach = -6.0f;  // In the ego's lane, closing
+    constexpr float kRecede   = 4.0f;   // Next lane, pulling away
+    for (int k = 0; k < 40; ++k) {
+        const float t     = 0.1f * k;
+        const float noise = (k % 2 ? 0.2f : -0.2f) * ((k % 3) ? 1.0f : -0.5f);
+        tracker.update(scanOf({{60.0f + kApproach * t + noise, 0.0f, 0, 0, 4, 2, 0.9f, 1},
+                               {20.0f + kRecede * t - noise, 3.5f, 0, 0, 4, 2, 0.9f, 1}}),
+                       100'000u * (k + 1));
+    }
+    ASSERT_EQ(out.last_tracks.size(), 2u);
+    for (const Track& track : out.last_tracks) {
+        const float truth = track.y_m < 1.0f ? kApproach : kRecede;
+        EXPECT_NEAR(track.vx_mps, truth, 0.3f) << track.id;
+    }
+    EXPECT_NEAR(out.leads.back().target_speed_mps, 25.0f + kApproach, 0.3f);
+    EXPECT_NEAR(out.leads.back().distance_m, 60.0f + kApproach * 3.9f, 0.3f);
+}
+
+TEST(Tracker, LeadSurvivesMissedAndOutlierScans) {
+    Capture out;
+    Tracker tracker(out.sink());
+    for (int k = 0; k < 10; ++k) {
+        tracker.update(scanOf({{40.0f, 0.0f, 0, 0, 4, 2, 0.9f, 1}}), 100'000u * (k + 1));
+    }
+    tracker.update(scanOf({{8.0f, 0.2f, 0, 0, 4, 2, 0.9f, 1}}), 1'100'000);  // Ghost, lead missed
+    EXPECT_NEAR(out.leads.back().distance_m, 40.0f, 0.5f);                   // Ghost is unconfirmed
+    tracker.update(scanOf({}), 1'200'000);
+    EXPECT_NEAR(out.leads.back().distance_m, 40.0f, 0.5f);                   // Coasting
+    EXPECT_FLOAT_EQ(out.leads.back().confidence, 0.9f * 0.5f * 0.5f);        // Fading with each miss
+
+    for (int k = 0; k < 5; ++k) tracker.update(scanOf({}), 1'300'000u + 100'000u * k);
+    EXPECT_EQ(tracker.trackCount(), 0u);
+    EXPECT_FLOAT_EQ(out.leads.back().distance_m, 999.0f);
+    EXPECT_FLOAT_EQ(out.leads.back().confidence, 0.0f);
+}
+
+TEST(Tracker, RadarReportsConfirmLeadAndClearPath) {
+    Capture out;
+    Tracker tracker(out.sink());
+    tracker.onEvent(EventType::SPEED_UPDATE, SpeedData{20.0f});
+    auto report = [&tracker](float distance, float speed, uint64_t time_us) {
+        tracker.updateRadar(RadarData{distance, speed, 0.8f}, time_us);
+    };
+
+    report(999.0f, 0.0f, 10'000);  // Radar sees nothing: a confident clear path
+    EXPECT_FLOAT_EQ(out.leads.back().distance_m, 999.0f);
+    EXPECT_FLOAT_EQ(out.leads.back().confidence, 0.8f);
+
+    // Car 30 m ahead at 15 m/s: unknown until confirmed, never "clear"
+    for (int k = 0; k < 3; ++k) {
+        report(30.0f - 0.05f * k, 15.0f, 20'000u + 10'000u * k);
+        if (k < 2) {
+            EXPECT_FLOAT_EQ(out.leads.back().confidence, 0.0f) << k;
+        }
+    }
+    EXPECT_NEAR(out.leads.back().distance_m, 29.9f, 0.05f);
+    EXPECT_NEAR(out.leads.back().target_speed_mps, 15.0f, 0.1f);
+    EXPECT_FLOAT_EQ(out.leads.back().confidence, 0.8f);
+
+    // A single ghost nearer than the lead neither replaces it nor costs it a miss
+    report(8.0f, 0.0f, 50'000);
+    EXPECT_NEAR(out.leads.back().distance_m, 29.85f, 0.05f);
+    EXPECT_EQ(tracker.trackCount(), 2u);
+}
+
+// A radar that reports a clear path ends the lead at once, however
+// confident its last detection was: no braking on a target that is gone.
+TEST(Tracker, RadarClearPathDropsLead) {
+    Capture out;
+    Tracker tracker(out.sink());
+    for (int k = 0; k < 3; ++k) tracker.updateRadar(RadarData{40.0f, 0.0f, 0.9f}, 100'000u * (k + 1));
+    ASSERT_NEAR(out.leads.back().distance_m, 40.0f, 0.05f);
+
+    tracker.updateRadar(RadarData{999.0f, 0.0f, 0.9f}, 400'000);
+    EXPECT_FLOAT_EQ(out.leads.back().distance_m, 999.0f);
+    EXPECT_FLOAT_EQ(out.leads.back().confidence, 0.9f);
+    EXPECT_EQ(tracker.trackCount(), 0u);
+
+    features::AdasManager mgr;
+    uint64_t now_us = 0;
+    mgr.setClock([&now_us] { return now_us; });
+    for (uint64_t t = 0; t < 6; ++t) {
+        now_us = 100'000 * (t + 1);
+        mgr.publish(EventType::SPEED_UPDATE, SpeedData{20.0f});
+        // Stopped car, closing at 20 m/s: TTC 2 s at the third report
+        mgr.publish(EventType::RADAR_UPDATE, RadarData{t < 3 ? 44.0f - 2.0f * t : 999.0f, 0.0f, 0.9f});
+        VehicleState state;
+        mgr.execute(state, now_us / 1000);
+        EXPECT_EQ(state.brake_requested, t == 2) << t;
+    }
+}
+
+// A camera list stamped before the last radar report arrives late: it must
+// not wind the tracker clock back.
+TEST(Tracker, LateScanDoesNotRewindClock) {
+    Capture out;
+    Tracker tracker(out.sink());
+    tracker.onEvent(EventType::SPEED_UPDATE, SpeedData{20.0f});
+    // Target closing at 10 m/s: x = 50 - 10 t
+    auto x = [](uint64_t time_us) { return 50.0f - 10.0f * static_cast<float>(time_us) * 1e-6f; };
+    for (uint64_t t : {100'000u, 200'000u, 300'000u, 400'000u, 500'000u}) {
+        tracker.updateRadar(RadarData{x(t), 10.0f, 0.9f}, t);
+    }
+    tracker.update(scanOf({{x(150'000), 0.0f, -10.0f, 0, 4, 2, 0.9f, 1}}), 150'000);  // Late
+    for (uint64_t t : {600'000u, 700'000u}) {
+        tracker.updateRadar(RadarData{x(t), 10.0f, 0.9f}, t);
+        EXPECT_NEAR(out.leads.back().distance_m, x(t), 0.25f) << t;
+    }
+}
+
+TEST(Tracker, ManagerBrakesOnTrackedObjectList) {
+    features::AdasManager mgr;
+    PayloadPool<DetectionList> pool(2);
+    mgr.publish(EventType::SPEED_UPDATE, SpeedData{20.0f});
+    VehicleState state;
+    for (int k = 0; k < 4; ++k) {
+        PooledWriter<DetectionList> objects = pool.acquire();
+        objects->count         = 1;
+        objects->detections[0] = {30.0f - 2.0f * k, 0.0f, -20.0f, 0.0f, 4, 2, 0.9f, 1};
+        ObjectListData frame;
+        frame.objects           = std::move(objects);
+        frame.stamp.acquired_us = 100'000u * (k + 1);
+        mgr.publish(EventType::OBJECT_LIST_UPDATE, frame);
+        state = VehicleState{};
+        mgr.execute(state, 100 * (k + 1));
+    }
+    EXPECT_TRUE(state.brake_requested);  // ~24 m at 20 m/s closing: TTC ~1.2 s
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "adas/features/AdasManager.hpp"
+#include "adas/signals/SignalValidator.hpp"
+#include "adas/signals/SignalWatchdog.hpp"
+
+using namespace adas;
+using namespace adas::signals;
+
+// Thousands of signals with timeouts spanning every wheel level, fed at
+// random: each must expire on exactly the tick a per-signal check predicts.
+TEST(SignalWatchdog, ExpiresOnExactTickAcrossLevels) {
+    constexpr std::size_t kSignals = 5000;
+    std::vector<uint64_t> fired_at(kSignals, 0);
+    SignalWatchdog watchdog([&](SignalId id, uint64_t now_ms) {
+        EXPECT_EQ(fired_at[id], 0u) << id;
+        fired_at[id] = now_ms;
+    });
+
+    std::mt19937_64 rng(7);
+    std::vector<uint64_t> last_feed(kSignals, 0);
+    for (std::size_t i = 0; i < kSignals; ++i) {
+        const uint64_t timeout = 1 + rng() % ((i % 4 == 3) ? 300'000 : (i % 4 == 2) ? 5'000 : 100);
+        ASSERT_EQ(watchdog.add(timeout), i);
+    }
+    for (std::size_t i = 0; i < kSignals; ++i) watchdog.feed(static_cast<SignalId>(i), 0);
+
+    // Keep feeding the first half for a while, in uneven steps.
+    for (uint64_t t = 0; t < 20'000; t += 1 + rng() % 40) {
+        watchdog.advance(t);
+        for (std::size_t i = 0; i < kSignals / 2; i += 1 + rng() % 3) {
+            if (fired_at[i] == 0) {
+                watchdog.feed(static_cast<SignalId>(i), t);
+                last_feed[i] = t;
+            }
+        }
+    }
+    watchdog.advance(400'000);
+
+    for (std::size_t i = 0; i < kSignals; ++i) {
+        EXPECT_EQ(fired_at[i], last_feed[i] + watchdog.timeoutMs(static_cast<SignalId>(i)) + 1) << i;
+        EXPECT_EQ(watchdog.status(static_cast<SignalId>(i)), SignalStatus::TIMEOUT);
+    }
+    EXPECT_EQ(watchdog.armed(), 0u);
+}
+
+TEST(SignalWatchdog, ValidatorTakesFreshnessFromWatchdog) {
+    SignalValidator v(0.0f, 200.0f, 0.6f, 200);
+    SignalWatchdog  watchdog;
+    const SignalId  id = v.watch(watchdog);
+    Signal<float>   s;
+    s.value      = 250.0f;  // Out of range
+    s.confidence = 0.9f;
+
+    v.validate(s, watchdog, id);
+    EXPECT_EQ(s.status, SignalStatus::INITIALIZING);
+
+    watchdog.feed(id, 1000);
+    watchdog.advance(1200);
+    v.validate(s, watchdog, id);
+    EXPECT_EQ(s.status, SignalStatus::OUT_OF_RANGE);
+
+    EXPECT_EQ(watchdog.advance(1201), 1u);
+    v.validate(s, watchdog, id);
+    EXPECT_EQ(s.status, SignalStatus::TIMEOUT);
+
+    EXPECT_TRUE(watchdog.feed(id, 1500));
+    EXPECT_FALSE(watchdog.feed(id, 1510));
+    s.value = 50.0f;
+    v.validate(s, watchdog, id);
+    EXPECT_EQ(s.status, SignalStatus::VALID);
+}
+
+// Radar goes silent while a close target is held: AEB must stop braking on
+// the stale target, and the loss and recovery are logged.
+TEST(SignalWatchdog, ManagerDropsStaleRadar) {
+    uint64_t now_us = 1'000'000;
+    features::AdasManager mgr;
+    mgr.setClock([&now_us] { return now_us; });
+    auto count = [&mgr](diagnostics::DTC code) {
+        diagnostics::DTCQuery q;
+        q.code = code;
+        return mgr.dtcManager().query(q).size();
+    };
+
+    VehicleState state;
+    for (int cycle = 0; cycle < 50; ++cycle, now_us += 10'000) {
+        mgr.publish(events::EventType::SPEED_UPDATE, events::SpeedData{20.0f});
+        if (cycle < 5) mgr.publish(events::EventType::RADAR_UPDATE, events::RadarData{8.0f, 0.0f, 0.95f});
+        state = VehicleState{};
+        mgr.execute(state, now_us / 1000);
+        if (cycle == 4) {
+            EXPECT_TRUE(state.brake_requested);
+        }
+    }
+    // The tracker's lead goes silent with the radar
+    EXPECT_EQ(mgr.inputStatus(events::EventType::RADAR_UPDATE), SignalStatus::TIMEOUT);
+    EXPECT_EQ(mgr.inputStatus(events::EventType::LEAD_UPDATE), SignalStatus::TIMEOUT);
+    EXPECT_EQ(mgr.inputStatus(events::EventType::SPEED_UPDATE), SignalStatus::VALID);
+    EXPECT_EQ(mgr.inputStatus(events::EventType::LANE_UPDATE), SignalStatus::INITIALIZING);
+    EXPECT_FALSE(state.brake_requested);
+    EXPECT_EQ(count(diagnostics::DTC::SIGNAL_TIMEOUT), 2u);
+
+    mgr.publish(events::EventType::RADAR_UPDATE, events::RadarData{80.0f, 20.0f, 0.95f});
+    mgr.execute(state, now_us / 1000);
+    EXPECT_EQ(mgr.inputStatus(events::EventType::RADAR_UPDATE), SignalStatus::VALID);
+    EXPECT_EQ(mgr.inputStatus(events::EventType::LEAD_UPDATE), SignalStatus::VALID);
+    EXPECT_EQ(count(diagnostics::DTC::SIGNAL_RECOVERED), 2u);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include "adas/sim/Sensors.hpp"
+#include "adas/sim/World.hpp"
+
+using namespace adas::sim;
+
+TEST(World, ConstantAccelerationIntegration) {
+    World world(0.1f);
+    ActorId car = world.addActor(0.0f, 0.0f, 10.0f);
+    world.setAcceleration(car, -2.0f);
+    for (int i = 0; i < 10; ++i) world.step();  // 1 s
+    EXPECT_NEAR(world.speed(car), 8.0f, 1e-4f);
+    EXPECT_NEAR(world.position(car), 8.9f, 1e-3f);  // semi-implicit Euler: sum of 9.8 .. 8.0 × 0.1
+    EXPECT_NEAR(world.time(), 1.0, 1e-6);
+}
+
+TEST(World, SpeedNeverGoesNegative) {
+    World world(0.1f);
+    ActorId car = world.addActor(0.0f, 0.0f, 1.0f);
+    world.setAcceleration(car, -9.0f);
+    world.advance(2.0f);
+    EXPECT_FLOAT_EQ(world.speed(car), 0.0f);
+    EXPECT_NEAR(world.time(), 2.0, 1e-6);
+}
+
+TEST(World, AdvanceToReachesAbsoluteTimes) {
+    World world(0.01f);
+    ActorId car = world.addActor(0.0f, 0.0f, 10.0f);
+    world.advanceTo(0.5);
+    EXPECT_NEAR(world.time(), 0.5, 1e-6);
+    world.advanceTo(0.3);  // never steps back
+    EXPECT_NEAR(world.time(), 0.5, 1e-6);
+    world.advanceTo(2.0);
+    EXPECT_NEAR(world.position(car), 20.0f, 1e-3f);
+}
+
+TEST(World, SteeringMovesActorSideways) {
+    World world(0.01f);
+    ActorId car = world.addActor(0.0f, 0.0f, 20.0f);
+    world.setSteering(car, -0.01f);  // left
+    world.advance(1.0f);
+    EXPECT_LT(world.heading(car), 0.0f);
+    EXPECT_LT(world.lateralOffset(car), 0.0f);
+}
+
+TEST(Sensors, RadarReportsNearestActorAheadInLane) {
+    World world;
+    ActorId ego = world.addActor(0.0f, 0.0f, 30.0f);
+    world.addActor(-10.0f, 0.0f, 35.0f);  // behind
+    world.addActor(40.0f, 3.5f, 20.0f);   // ahead, next lane
+    world.addActor(60.0f, 0.5f, 25.0f);   // ahead, same lane
+    world.addActor(90.0f, 0.0f, 10.0f);   // further ahead, same lane
+    RadarSensor radar;
+    adas::events::RadarData r = radar.sense(world, ego);
+    EXPECT_FLOAT_EQ(r.distance_m, 60.0f);
+    EXPECT_FLOAT_EQ(r.target_speed_mps, 25.0f);
+}
+
+TEST(Sensors, RadarReportsNoTargetWhenLaneIsClear) {
+    World world;
+    ActorId ego = world.addActor(0.0f, 0.0f, 30.0f);
+    world.addActor(500.0f, 0.0f, 30.0f);  // out of range
+    RadarSensor radar;
+    EXPECT_FLOAT_EQ(radar.sense(world, ego).distance_m, 999.0f);
+}
+
+// The position-ordered search must find what a scan of every actor finds,
+// ahead and behind, also after actors overtake each other.
+TEST(Sensors, RadarMatchesFullScanInDenseTraffic) {
+    World world(0.1f);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> pos(0.0f, 2000.0f);
+    std::uniform_real_distribution<float> speed(15.0f, 35.0f);
+    for (int i = 0; i < 2000; ++i) {
+        world.addActor(pos(rng), 3.5f * static_cast<float>(rng() % 3) + 0.3f * static_cast<float>(rng() % 3),
+                       speed(rng));
+    }
+
+    auto scan = [&world](ActorId ego, float direction) {
+        float best = 200.0f;
+        for (ActorId i = 0; i < world.actorCount(); ++i) {
+            const float gap = (world.position(i) - world.position(ego)) * direction;
+            if (i == ego || gap <= 0.0f || gap >= best) continue;
+            if (std::abs(world.lateralOffset(i) - world.lateralOffset(ego)) >= world.laneWidth() * 0.5f) continue;
+            best = gap;
+        }
+        return best < 200.0f ? best : 999.0f;
+    };
+
+    RadarSensor front;
+    RadarSensor rear(200.0f, 0.95f, RadarSensor::Facing::REAR);
+    for (int step = 0; step < 3; ++step) {
+        for (ActorId ego = 0; ego < world.actorCount(); ego += 7) {
+            ASSERT_FLOAT_EQ(front.sense(world, ego).distance_m, scan(ego, 1.0f)) << ego;
+            ASSERT_FLOAT_EQ(rear.sense(world, ego).distance_m, scan(ego, -1.0f)) << ego;
+        }
+        world.advance(5.0f);  // Plenty of overtaking
+    }
+}
+
+TEST(Sensors, LaneSensorReportsOffsetFromLaneCentre) {
+    World world;
+    ActorId ego = world.addActor(0.0f, 3.9f, 30.0f);  // lane 1 centre is 3.5 m
+    LaneSensor lane;
+    EXPECT_NEAR(lane.sense(world, ego).lateral_deviation_m, 0.4f, 1e-5f);
+}
+
+TEST(World, DenseTrafficStep) {
+    World world(0.01f);
+    world.reserve(10000);
+    for (int i = 0; i < 10000; ++i) {
+        world.addActor(static_cast<float>(i) * 10.0f, 3.5f * static_cast<float>(i % 4), 25.0f);
+    }
+    world.advance(1.0f);
+    EXPECT_EQ(world.actorCount(), 10000u);
+    EXPECT_NEAR(world.position(9999), 99990.0f + 25.0f, 0.05f);
+}